@@ -9,6 +9,7 @@
 #include <gna_plugin_log.hpp>
 
 #include "cnn.h"
+#include "floatmath_kernels.hpp"
 #include "backend/dnn_types.h"
 #include "backend/gna_limitations.hpp"
 #include "gna_lib_ver_selector.hpp"
@@ -37,15 +38,16 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < numberOfOutputsPerFilter; j++, input += convolutionStride, output += numberOfFilters) {
-        auto filter = filters;
-        for (uint32_t i = 0; i < numberOfFilters; i++, filter += filterSize) {
-            output[i] = biases[i];
-            for (uint32_t k = 0; k < filterSize; k++) {
-                output[i] += input[k] * filter[k];
-            }
+    // output[j * numberOfFilters + i] = biases[i] + sum_k input[j * convolutionStride + k] * filters[i * filterSize + k]
+    const size_t macsPerOutput = static_cast<size_t>(numberOfFilters) * filterSize;
+    GNAPluginNS::runtime::parallelRows(numberOfOutputsPerFilter, macsPerOutput, [&](size_t start, size_t end) {
+        for (size_t j = start; j < end; j++) {
+            std::copy(biases, biases + numberOfFilters, output + j * numberOfFilters);
         }
-    }
+        GNAPluginNS::runtime::XARCH::sgemm_nt(input + start * convolutionStride, convolutionStride, filters, filterSize,
+                                              output + start * numberOfFilters, numberOfFilters, 1,
+                                              end - start, numberOfFilters, filterSize, 1.0f);
+    });
 }
 
 namespace {
@@ -188,55 +190,6 @@ void CNNMaxPool2DFloat(intel_dnn_component_t* component) {
 
 #if GNA_LIB_VER == 2
 
-namespace {
-
-bool matchesPaddedArea(unsigned filterIndex, unsigned outputIndex, unsigned inputSize, unsigned paddingSize, unsigned stride) {
-    const auto paddedIndex = stride * outputIndex + filterIndex;
-    if (paddedIndex >= inputSize + 2 * paddingSize) {
-        THROW_GNA_EXCEPTION << "In: isZeroPaddingCase, paddedIndex >= inputSize + 2 * paddingSize";
-    }
-    if (paddedIndex < paddingSize || paddedIndex >= inputSize + paddingSize) {
-        return true;
-    }
-    return false;
-}
-
-float CNN2DFilter32SingleHWC(const float bias, const float* filter, const unsigned KH, const unsigned KW, const unsigned KC,
-    const float* image, const unsigned IH, const unsigned IW, const unsigned IC,
-    const unsigned oh, const unsigned ow, const unsigned oc,
-    const std::array<uint32_t, 2>& convStride,
-    const std::array<uint32_t, 2>& zeroPadding) {
-
-    const auto cSH = convStride[0];
-    const auto cSW = convStride[1];
-
-    const auto zPH = zeroPadding[0];
-    const auto zPW = zeroPadding[1];
-    float output = 0;
-    for (unsigned kh = 0; kh < KH; kh++) {
-        for (unsigned kw = 0; kw < KW; kw++) {
-            for (unsigned kc = 0; kc < KC; kc++) {
-                if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) &&
-                    !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
-                    const auto ih = (cSH * oh + kh) - zPH;
-                    const auto iw = (cSW * ow + kw) - zPW;
-                    const auto ic = kc;
-                    const auto imageIndex = getQubeIndex(ih, iw, ic, IW, IC);
-                    const auto imageElement = image[imageIndex];
-                    const auto filterIndex = getQubeIndex(kh, kw, kc, KW, KC);
-                    const auto filterElement = filter[filterIndex];
-                    const auto product = imageElement * filterElement;
-                    output += product;
-                }
-            }
-        }
-    }
-    output += bias;
-    return output;
-}
-
-} // namespace
-
 void CNN2DFilter32(intel_dnn_component_t* component) {
     float* ptr_filters = reinterpret_cast<float*>(component->op.conv2D.ptr_filters);
     float* ptr_biases = reinterpret_cast<float*>(component->op.conv2D.ptr_biases);
@@ -265,21 +218,56 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
     if (kc != IC) {
         THROW_GNA_EXCEPTION << "Depth of filter should be equal to input depth!" << layer_name;
     }
-    auto kernelIndex = 0;
-    for (unsigned oc = 0; oc < OC; oc++) {
-        for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), ptr_filters + kernelIndex, kh, kw, kc,
-                    ptr_inputs, IH, IW, IC,
-                    oh, ow, oc,
-                    component->op.conv2D.convStride,
-                    component->op.conv2D.zeroPadding);
+
+    const int64_t SH = component->op.conv2D.convStride[0];
+    const int64_t SW = component->op.conv2D.convStride[1];
+    const int64_t PH = component->op.conv2D.zeroPadding[0];
+    const int64_t PW = component->op.conv2D.zeroPadding[1];
+    // kernel padded to 16B = 4 * sizeof(float)
+    const size_t kernelStride = ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+
+    // the output columns whose receptive field does not overlap the left and right padding, the rows of the filters
+    // are multiplied by the sliding windows of such columns at once
+    const int64_t owBegin = std::min<int64_t>(OW, (PW + SW - 1) / SW);
+    const int64_t owEnd = std::max<int64_t>(owBegin, std::min<int64_t>(OW, (static_cast<int64_t>(IW) + PW - kw) / SW + 1));
+
+    const size_t macsPerRow = static_cast<size_t>(OW) * OC * kh * kw * kc;
+    GNAPluginNS::runtime::parallelRows(OH, macsPerRow, [&](size_t start, size_t end) {
+        for (size_t oh = start; oh < end; oh++) {
+            float* outputRow = ptr_outputs + oh * OW * OC;
+            for (size_t ow = 0; ow < OW; ow++) {
+                std::copy(ptr_biases, ptr_biases + OC, outputRow + ow * OC);
+            }
+            for (int64_t fh = 0; fh < kh; fh++) {
+                const int64_t ih = static_cast<int64_t>(oh) * SH + fh - PH;
+                if (ih < 0 || ih >= IH) {
+                    continue;
+                }
+                const float* imageRow = ptr_inputs + ih * IW * IC;
+                const float* filterRow = ptr_filters + fh * kw * kc;
+                if (owBegin < owEnd) {
+                    GNAPluginNS::runtime::XARCH::sgemm_nt(imageRow + (owBegin * SW - PW) * IC, SW * IC, filterRow, kernelStride,
+                                                          outputRow + owBegin * OC, OC, 1, owEnd - owBegin, OC, kw * kc, 1.0f);
+                }
+                // only the part of the filter row which overlaps the image contributes to the border columns
+                auto convolveBorder = [&](int64_t ow) {
+                    const int64_t iw = ow * SW - PW;
+                    const int64_t fwBegin = std::max<int64_t>(0, -iw);
+                    const int64_t fwEnd = std::min<int64_t>(kw, static_cast<int64_t>(IW) - iw);
+                    if (fwBegin < fwEnd) {
+                        GNAPluginNS::runtime::XARCH::sgemm_nt(imageRow + (iw + fwBegin) * IC, 0, filterRow + fwBegin * kc, kernelStride,
+                                                              outputRow + ow * OC, 0, 1, 1, OC, (fwEnd - fwBegin) * kc, 1.0f);
+                    }
+                };
+                for (int64_t ow = 0; ow < owBegin; ow++) {
+                    convolveBorder(ow);
+                }
+                for (int64_t ow = owEnd; ow < OW; ow++) {
+                    convolveBorder(ow);
+                }
             }
         }
-        // kernel padded to 16B = 4 * sizeof(float)
-        kernelIndex += ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
-    }
+    });
 }
 
 #endif
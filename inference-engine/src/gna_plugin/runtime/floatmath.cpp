@@ -1,13 +1,46 @@
 // Copyright (C) 2018-2021 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines of the software runtime
 //
 
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 
 #include "floatmath.h"
+#include "floatmath_kernels.hpp"
+
+namespace {
+
+using GNAPluginNS::runtime::parallelRows;
+
+// Copies op(X) [rows x cols] to the row major buffer, so that the kernel traverses both operands along the rows
+std::vector<float> packRows(const float *X, const MKL_INT ldx, const MKL_INT rows, const MKL_INT cols, const bool transposed) {
+    std::vector<float> packed(static_cast<size_t>(rows) * cols);
+    for (MKL_INT r = 0; r < rows; r++) {
+        for (MKL_INT c = 0; c < cols; c++) {
+            packed[r * cols + c] = transposed ? X[c * ldx + r] : X[r * ldx + c];
+        }
+    }
+    return packed;
+}
+
+// C [M x N] = beta * C + alpha * A * B^T, where the rows of A [M x K] and B [N x K] are contiguous
+void sgemmRows(const MKL_INT M, const MKL_INT N, const MKL_INT K, const float alpha, const float *A, const MKL_INT lda,
+               const float *B, const MKL_INT ldb, const float beta, float *C, const MKL_INT ldc) {
+    parallelRows(M, static_cast<size_t>(N) * K, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            for (MKL_INT j = 0; j < N; j++) {
+                C[i * ldc + j] = (beta == 0.0f) ? 0.0f : beta * C[i * ldc + j];
+            }
+        }
+        GNAPluginNS::runtime::XARCH::sgemm_nt(A + start * lda, lda, B, ldb, C + start * ldc, ldc, 1,
+                                              end - start, N, K, alpha);
+    });
+}
+
+}  // namespace
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -19,44 +52,21 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                   const MKL_INT K, const float alpha, const float *A,
                   const MKL_INT lda, const float *B, const MKL_INT ldb,
                   const float beta, float *C, const MKL_INT ldc) {
-    int i, j, k;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm!\n");
         throw -1;
     }
 
+    // alpha is only applied when B is transposed, otherwise C is either accumulated (beta == 1) or overwritten
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        const auto Bt = packRows(B, ldb, N, K, true);
+        sgemmRows(M, N, K, 1.0f, A, lda, Bt.data(), K, (beta == 1.0) ? 1.0f : 0.0f, C, ldc);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum;
-                sum = beta * C[i * ldc + j];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        sgemmRows(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        const auto At = packRows(A, lda, M, K, true);
+        const auto Bt = packRows(B, ldb, N, K, true);
+        sgemmRows(M, N, K, 1.0f, At.data(), K, Bt.data(), K, (beta == 1.0) ? 1.0f : 0.0f, C, ldc);
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm!\n");
         throw -1;
@@ -105,16 +115,17 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        const auto Bt = packRows(B, ldb, N, K, true);
+        parallelRows(L, static_cast<size_t>(N) * K, [&](size_t start, size_t end) {
+            for (size_t l = start; l < end; l++) {
+                float *Crow = C + l * ldc;
+                for (MKL_INT j = 0; j < N; j++) {
+                    Crow[j] = (beta == 1.0) ? Crow[j] : 0.0f;
                 }
-                C[l * ldc + j] = sum;
+                GNAPluginNS::runtime::XARCH::sgemm_nt(A + OutputList[l] * lda, lda, Bt.data(), K, Crow, ldc, 1,
+                                                      1, N, K, 1.0f);
             }
-        }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -155,18 +166,16 @@ void sgemv_split(const uint32_t N,
                  float *C) {
     uint32_t num_columns = K1 + K2;
     uint32_t num_rows = N;
-    uint32_t i, j;
 
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
+    parallelRows(num_rows, num_columns, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            C[i] = B[i];
         }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
-    }
+        GNAPluginNS::runtime::XARCH::sgemm_nt(X + start * num_columns, num_columns, A1, 0, C + start, 1, 0,
+                                              end - start, 1, K1, 1.0f);
+        GNAPluginNS::runtime::XARCH::sgemm_nt(X + start * num_columns + K1, num_columns, A2, 0, C + start, 1, 0,
+                                              end - start, 1, K2, 1.0f);
+    });
 }
 
 #ifdef __cplusplus
@@ -0,0 +1,101 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "floatmath_kernels.hpp"
+
+#if defined(HAVE_AVX2)
+#include <immintrin.h>
+#endif
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+
+namespace {
+
+#if defined(HAVE_AVX2)
+inline float horizontalSum(__m256 v) {
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    sum = _mm_hadd_ps(sum, sum);
+    sum = _mm_hadd_ps(sum, sum);
+    return _mm_cvtss_f32(sum);
+}
+#endif
+
+// the number of the rows of B multiplied at once, each element of A is loaded once per the block
+constexpr size_t kColsBlock = 4;
+
+}  // namespace
+
+void sgemm_nt(const float* A, size_t lda, const float* B, size_t ldb, float* C, size_t ldc_row, size_t ldc_col,
+              size_t rows, size_t cols, size_t depth, float alpha) {
+    for (size_t i = 0; i < rows; i++) {
+        const float* a = A + i * lda;
+        float* c = C + i * ldc_row;
+
+        size_t j = 0;
+        for (; j + kColsBlock <= cols; j += kColsBlock) {
+            const float* b0 = B + j * ldb;
+            const float* b1 = b0 + ldb;
+            const float* b2 = b1 + ldb;
+            const float* b3 = b2 + ldb;
+            float sum0 = 0.f, sum1 = 0.f, sum2 = 0.f, sum3 = 0.f;
+            size_t k = 0;
+#if defined(HAVE_AVX2)
+            __m256 acc0 = _mm256_setzero_ps();
+            __m256 acc1 = _mm256_setzero_ps();
+            __m256 acc2 = _mm256_setzero_ps();
+            __m256 acc3 = _mm256_setzero_ps();
+            for (; k + 8 <= depth; k += 8) {
+                const __m256 va = _mm256_loadu_ps(a + k);
+                acc0 = _mm256_fmadd_ps(va, _mm256_loadu_ps(b0 + k), acc0);
+                acc1 = _mm256_fmadd_ps(va, _mm256_loadu_ps(b1 + k), acc1);
+                acc2 = _mm256_fmadd_ps(va, _mm256_loadu_ps(b2 + k), acc2);
+                acc3 = _mm256_fmadd_ps(va, _mm256_loadu_ps(b3 + k), acc3);
+            }
+            sum0 = horizontalSum(acc0);
+            sum1 = horizontalSum(acc1);
+            sum2 = horizontalSum(acc2);
+            sum3 = horizontalSum(acc3);
+#endif
+            for (; k < depth; k++) {
+                sum0 += a[k] * b0[k];
+                sum1 += a[k] * b1[k];
+                sum2 += a[k] * b2[k];
+                sum3 += a[k] * b3[k];
+            }
+            c[j * ldc_col] += alpha * sum0;
+            c[(j + 1) * ldc_col] += alpha * sum1;
+            c[(j + 2) * ldc_col] += alpha * sum2;
+            c[(j + 3) * ldc_col] += alpha * sum3;
+        }
+
+        for (; j < cols; j++) {
+            const float* b = B + j * ldb;
+            float sum = 0.f;
+            size_t k = 0;
+#if defined(HAVE_AVX2)
+            // independent accumulators hide the latency of FMA, e.g. for the single column of the batch 1 input
+            __m256 acc0 = _mm256_setzero_ps();
+            __m256 acc1 = _mm256_setzero_ps();
+            for (; k + 16 <= depth; k += 16) {
+                acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + k), _mm256_loadu_ps(b + k), acc0);
+                acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + k + 8), _mm256_loadu_ps(b + k + 8), acc1);
+            }
+            for (; k + 8 <= depth; k += 8) {
+                acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + k), _mm256_loadu_ps(b + k), acc0);
+            }
+            sum = horizontalSum(_mm256_add_ps(acc0, acc1));
+#endif
+            for (; k < depth; k++) {
+                sum += a[k] * b[k];
+            }
+            c[j * ldc_col] += alpha * sum;
+        }
+    }
+}
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
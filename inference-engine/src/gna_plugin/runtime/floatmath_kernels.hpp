@@ -0,0 +1,51 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+#include <ie_parallel.hpp>
+
+namespace GNAPluginNS {
+namespace runtime {
+
+/**
+ * @brief Minimal number of multiply-accumulate operations for which the floating runtime primitives are split
+ * between the threads
+ */
+constexpr size_t kMinParallelWork = 1 << 14;
+
+/**
+ * @brief Calls func(start, end) for the ranges of [0, work) split between the threads, or once for the whole range
+ * if the amount of the multiply-accumulate operations is too small to be split
+ */
+template <typename F>
+void parallelRows(const size_t work, const size_t macsPerRow, const F& func) {
+    if (work < 2 || work * macsPerRow < kMinParallelWork) {
+        func(0, work);
+        return;
+    }
+    InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(work, nthr, ithr, start, end);
+        if (start < end) {
+            func(start, end);
+        }
+    });
+}
+
+namespace XARCH {
+
+/**
+ * @brief Accumulates the dot products of the rows of A with the rows of B:
+ * C[i * ldc_row + j * ldc_col] += alpha * sum_k A[i * lda + k] * B[j * ldb + k]
+ * where i < rows, j < cols and k < depth. Rows of A may overlap, e.g. the sliding windows of the convolution input
+ */
+void sgemm_nt(const float* A, size_t lda, const float* B, size_t ldb, float* C, size_t ldc_row, size_t ldc_col,
+              size_t rows, size_t cols, size_t depth, float alpha);
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
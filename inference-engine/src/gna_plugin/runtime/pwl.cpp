@@ -25,6 +25,7 @@
 #endif
 
 #include "pwl.h"
+#include "floatmath_kernels.hpp"
 #include "gna_plugin_log.hpp"
 #include "gna_slope_scale.h"
 #include "round_float_define.hpp"
@@ -970,11 +971,13 @@ void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     }
 }
 
-void PwlApply32(intel_dnn_component_t *component,
-                uint32_t num_row_start,
-                uint32_t num_row_end,
-                uint32_t num_col_start,
-                uint32_t num_col_end) {
+namespace {
+
+void PwlApply32Block(intel_dnn_component_t *component,
+                     uint32_t num_row_start,
+                     uint32_t num_row_end,
+                     uint32_t num_col_start,
+                     uint32_t num_col_end) {
     intel_piecewiselinear_t *transform = reinterpret_cast<intel_piecewiselinear_t *>(&component->op.pwl);
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
@@ -1129,3 +1132,24 @@ void PwlApply32(intel_dnn_component_t *component,
             THROW_GNA_EXCEPTION << component->original_layer_name << ", Unknown piecewise linear function type: " << transform->func_id.type;
     }
 }
+
+}  // namespace
+
+void PwlApply32(intel_dnn_component_t *component,
+                uint32_t num_row_start,
+                uint32_t num_row_end,
+                uint32_t num_col_start,
+                uint32_t num_col_end) {
+    const size_t num_rows = num_row_end - num_row_start + 1;
+    const size_t num_cols = num_col_end - num_col_start + 1;
+    // the activation is applied element-wise, so the rows are split between the threads, or the columns of a single row
+    if (num_rows > 1) {
+        GNAPluginNS::runtime::parallelRows(num_rows, num_cols, [&](size_t start, size_t end) {
+            PwlApply32Block(component, num_row_start + start, num_row_start + end - 1, num_col_start, num_col_end);
+        });
+    } else {
+        GNAPluginNS::runtime::parallelRows(num_cols, 1, [&](size_t start, size_t end) {
+            PwlApply32Block(component, num_row_start, num_row_end, num_col_start + start, num_col_start + end - 1);
+        });
+    }
+}
@@ -100,6 +100,55 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key == PluginConfigInternalParams::KEY_SNIPPETS_MODE) {
+            if (val == PluginConfigInternalParams::ENABLE)
+                snippetsMode = SnippetsMode::Enable;
+            else if (val == PluginConfigInternalParams::IGNORE_CALLBACK)
+                snippetsMode = SnippetsMode::IgnoreCallback;
+            else if (val == PluginConfigInternalParams::DISABLE)
+                snippetsMode = SnippetsMode::Disable;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_SNIPPETS_MODE
+                    << ". Expected values: ENABLE/DISABLE/IGNORE_CALLBACK";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY
+                           << ". Expected only non negative numbers";
+            rtCacheCapacity = static_cast<size_t>(val_i);
+        } else if (key == PluginConfigInternalParams::KEY_CPU_STREAM_AFFINITY) {
+            if (val == PluginConfigParams::YES) streamAffinity = true;
+            else if (val == PluginConfigParams::NO) streamAffinity = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_STREAM_AFFINITY
+                           << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES) {
+            if (val == PluginConfigParams::YES) parallelBranches = true;
+            else if (val == PluginConfigParams::NO) parallelBranches = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES
+                           << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_HW_PERF_COUNTERS) {
+            if (val == PluginConfigParams::YES) collectHwPerfCounters = true;
+            else if (val == PluginConfigParams::NO) collectHwPerfCounters = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_HW_PERF_COUNTERS
+                           << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_LAYOUT_OPTIMIZATION) {
+            if (val == PluginConfigParams::YES) layoutOptimization = true;
+            else if (val == PluginConfigParams::NO) layoutOptimization = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_LAYOUT_OPTIMIZATION
+                           << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_WEIGHTS_CACHE_DIR) {
+            // empty string means that the cache is switched off
+            weightsCacheDir = val;
         } else if (key == PluginConfigParams::KEY_ENFORCE_BF16) {
             if (val == PluginConfigParams::YES) {
                 if (with_cpu_x86_avx512_core()) {
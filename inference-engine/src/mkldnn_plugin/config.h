@@ -21,11 +21,24 @@ struct Config {
         On,
     };
 
+    enum SnippetsMode {
+        Enable,
+        IgnoreCallback,
+        Disable,
+    };
+
     bool collectPerfCounters = false;
+    bool collectHwPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
+    SnippetsMode snippetsMode = SnippetsMode::Enable;
+    size_t rtCacheCapacity = 100ul;
+    bool streamAffinity = true;
+    bool parallelBranches = false;
+    bool layoutOptimization = false;
+    std::string weightsCacheDir = "";
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
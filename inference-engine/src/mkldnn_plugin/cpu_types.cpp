@@ -182,7 +182,12 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "NonMaxSuppressionIEInternal", NonMaxSuppression},
         { "MatrixNms", MatrixNms},
         { "MulticlassNms", MulticlassNms},
+        { "NV12toRGB", ColorConvert},
+        { "NV12toBGR", ColorConvert},
+        { "I420toRGB", ColorConvert},
+        { "I420toBGR", ColorConvert},
         { "Reference", Reference},
+        { "Subgraph", Subgraph},
 };
 
 Type TypeFromName(const std::string& type) {
@@ -362,8 +367,12 @@ std::string NameFromType(const Type type) {
             return "MatrixNms";
         case MulticlassNms:
             return "MulticlassNms";
+        case ColorConvert:
+            return "ColorConvert";
         case Reference:
             return "Reference";
+        case Subgraph:
+            return "Subgraph";
         default:
             return "Unknown";
     }
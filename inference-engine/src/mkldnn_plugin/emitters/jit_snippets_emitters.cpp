@@ -0,0 +1,300 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_snippets_emitters.hpp"
+
+#include <snippets/op/kernel.hpp>
+#include <snippets/op/tile.hpp>
+#include <snippets/op/scalar.hpp>
+
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace MKLDNNPlugin {
+
+#define GET_OFF(field) offsetof(jit_snippets_call_args, field)
+
+/// KERNEL ///
+jit_kernel_emitter::jit_kernel_emitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    auto kernel = ngraph::as_type_ptr<ngraph::snippets::op::Kernel>(n);
+    if (!kernel)
+        IE_THROW() << "jit_kernel_emitter expects Kernel operation, got " << n->get_type_name();
+    code = kernel->region;
+}
+
+void jit_kernel_emitter::emit_impl(const std::vector<size_t>& in,
+                                   const std::vector<size_t>& out,
+                                   const std::vector<size_t>& pool,
+                                   const std::vector<size_t>& gpr,
+                                   const MKLDNNPlugin::emitter_context *emit_context) const {
+    const size_t num_inputs = in[0];
+    const size_t num_outputs = in[1];
+    if (num_inputs + num_outputs > SNIPPETS_MAX_PTRS)
+        IE_THROW() << "jit_kernel_emitter supports up to " << SNIPPETS_MAX_PTRS << " pointers, got " << num_inputs + num_outputs;
+
+    Reg64 reg_const_params = abi_param1;
+    // work amount is kept in the same register during the whole kernel, jit_tile_emitter decrements it
+    Reg64 reg_work_amount = abi_not_param1;
+
+    h->preamble();
+
+    for (size_t i = 0; i < num_inputs; i++)
+        h->mov(Reg64(static_cast<int>(Operand::R8 + i)), h->ptr[reg_const_params + GET_OFF(src_ptrs) + i * sizeof(void*)]);
+    for (size_t i = 0; i < num_outputs; i++)
+        h->mov(Reg64(static_cast<int>(Operand::R8 + num_inputs + i)), h->ptr[reg_const_params + GET_OFF(dst_ptrs) + i * sizeof(void*)]);
+    h->mov(reg_work_amount, h->ptr[reg_const_params + GET_OFF(work_amount)]);
+
+    for (auto& c : code) {
+        c.first->emit_code(c.second.first, c.second.second, pool, gpr);
+    }
+
+    h->postamble();
+}
+
+/// TILE ///
+jit_tile_emitter::jit_tile_emitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    auto tile = ngraph::as_type_ptr<ngraph::snippets::op::Tile>(n);
+    if (!tile)
+        IE_THROW() << "jit_tile_emitter expects Tile operation, got " << n->get_type_name();
+    code = tile->region;
+}
+
+void jit_tile_emitter::emit_impl(const std::vector<size_t>& in,
+                                 const std::vector<size_t>& out,
+                                 const std::vector<size_t>& pool,
+                                 const std::vector<size_t>& gpr,
+                                 const MKLDNNPlugin::emitter_context *emit_context) const {
+    const size_t inc = in[0];
+    Reg64 reg_work_amount = abi_not_param1;
+
+    Label for_body;
+    Label for_end;
+
+    h->cmp(reg_work_amount, inc);
+    h->jl(for_end, CodeGenerator::T_NEAR);
+
+    h->L(for_body);
+    {
+        for (auto& c : code) {
+            c.first->emit_code(c.second.first, c.second.second, pool, gpr);
+        }
+
+        h->sub(reg_work_amount, inc);
+        h->cmp(reg_work_amount, inc);
+        h->jge(for_body, CodeGenerator::T_NEAR);
+    }
+    h->L(for_end);
+}
+
+/// BROADCAST_MOVE ///
+jit_broadcast_move_emitter::jit_broadcast_move_emitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    use_broadcast = n->get_input_shape(0).back() != n->get_output_shape(0).back();
+}
+
+void jit_broadcast_move_emitter::emit_impl(const std::vector<size_t>& in,
+                                           const std::vector<size_t>& out,
+                                           const std::vector<size_t>& pool,
+                                           const std::vector<size_t>& gpr,
+                                           const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_broadcast_move_emitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src0 = Vmm(in[0]);
+    Vmm vmm_dst = Vmm(out[0]);
+
+    if (use_broadcast) {
+        h->uni_vbroadcastss(vmm_dst, Xmm(in[0]));
+    } else if (vmm_dst.getIdx() != vmm_src0.getIdx()) {
+        h->uni_vmovups(vmm_dst, vmm_src0);
+    }
+}
+
+/// SCALAR ///
+jit_scalar_emitter::jit_scalar_emitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    auto scalar = ngraph::as_type_ptr<ngraph::snippets::op::Scalar>(n);
+    if (!scalar)
+        IE_THROW() << "jit_scalar_emitter expects Scalar operation, got " << n->get_type_name();
+    value = cpu::x64::float2int(scalar->cast_vector<float>()[0]);
+
+    prepare_table();
+}
+
+void jit_scalar_emitter::register_table_entries() {
+    push_arg_entry_of("scalar", value, true);
+}
+
+void jit_scalar_emitter::emit_impl(const std::vector<size_t>& in,
+                                   const std::vector<size_t>& out,
+                                   const std::vector<size_t>& pool,
+                                   const std::vector<size_t>& gpr,
+                                   const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_scalar_emitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_dst = Vmm(out[0]);
+
+    h->uni_vmovups(vmm_dst, table_val("scalar"));
+}
+
+/// MEMORY ///
+jit_memory_emitter::jit_memory_emitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    auto& rt = n->get_rt_info();
+    auto it = rt.find("effectiveAddress");
+    if (it == rt.end() || it->second.empty())
+        IE_THROW() << "Effective address is not assigned for " << n->get_friendly_name() << " (" << n->get_type_name() << ")";
+    ea = ngraph::as_type_ptr<ngraph::VariantWrapper<int64_t>>(it->second)->get();
+}
+
+/// STORE ///
+void jit_snippets_store_emitter::emit_impl(const std::vector<size_t>& in,
+                                           const std::vector<size_t>& out,
+                                           const std::vector<size_t>& pool,
+                                           const std::vector<size_t>& gpr,
+                                           const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_snippets_store_emitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 out_reg(static_cast<int>(ea));
+    Vmm vmm_src0 = Vmm(in[0]);
+
+    h->uni_vmovups(h->ptr[out_reg], vmm_src0);
+    h->add(out_reg, get_vec_length());
+}
+
+/// SCALAR_STORE ///
+void jit_snippets_scalar_store_emitter::emit_impl(const std::vector<size_t>& in,
+                                                  const std::vector<size_t>& out,
+                                                  const std::vector<size_t>& pool,
+                                                  const std::vector<size_t>& gpr,
+                                                  const MKLDNNPlugin::emitter_context *emit_context) const {
+    Reg64 out_reg(static_cast<int>(ea));
+
+    h->uni_vmovss(h->ptr[out_reg], Xmm(in[0]));
+    h->add(out_reg, sizeof(float));
+}
+
+/// LOAD ///
+jit_snippets_load_emitter::jit_snippets_load_emitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_memory_emitter(h, isa, n) {
+    // pointer stays the same for the tensors broadcasted along the innermost dimension
+    // and the only element is broadcasted to the whole vector
+    broadcast_innermost = n->get_input_shape(0).back() == 1;
+}
+
+void jit_snippets_load_emitter::emit_impl(const std::vector<size_t>& in,
+                                          const std::vector<size_t>& out,
+                                          const std::vector<size_t>& pool,
+                                          const std::vector<size_t>& gpr,
+                                          const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_snippets_load_emitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 in_reg(static_cast<int>(ea));
+    Vmm vmm_dst = Vmm(out[0]);
+
+    if (broadcast_innermost) {
+        h->uni_vbroadcastss(vmm_dst, h->ptr[in_reg]);
+    } else {
+        h->uni_vmovups(vmm_dst, h->ptr[in_reg]);
+        h->add(in_reg, get_vec_length());
+    }
+}
+
+/// BROADCAST_LOAD ///
+void jit_snippets_broadcast_load_emitter::emit_impl(const std::vector<size_t>& in,
+                                                    const std::vector<size_t>& out,
+                                                    const std::vector<size_t>& pool,
+                                                    const std::vector<size_t>& gpr,
+                                                    const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_snippets_broadcast_load_emitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 in_reg(static_cast<int>(ea));
+    Vmm vmm_dst = Vmm(out[0]);
+
+    // the pointer is not incremented since the broadcasted value is reused by every iteration
+    h->uni_vbroadcastss(vmm_dst, h->ptr[in_reg]);
+}
+
+/// SCALAR_LOAD ///
+jit_snippets_scalar_load_emitter::jit_snippets_scalar_load_emitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_memory_emitter(h, isa, n) {
+    broadcast_innermost = n->get_input_shape(0).back() == 1;
+}
+
+void jit_snippets_scalar_load_emitter::emit_impl(const std::vector<size_t>& in,
+                                                 const std::vector<size_t>& out,
+                                                 const std::vector<size_t>& pool,
+                                                 const std::vector<size_t>& gpr,
+                                                 const MKLDNNPlugin::emitter_context *emit_context) const {
+    Reg64 in_reg(static_cast<int>(ea));
+
+    h->uni_vmovss(Xmm(out[0]), h->ptr[in_reg]);
+    if (!broadcast_innermost)
+        h->add(in_reg, sizeof(float));
+}
+
+}   // namespace MKLDNNPlugin
@@ -0,0 +1,241 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/rt_info.hpp>
+#include <ie_ngraph_utils.hpp>
+
+#include "jit_emitter.hpp"
+
+namespace MKLDNNPlugin {
+
+#define SNIPPETS_MAX_SNIPPETS_DIMS 6
+#define SNIPPETS_MAX_PTRS 7
+
+/**
+ * Arguments of the kernel produced by jit_kernel_emitter.
+ * Pointers are expected in the order of Subgraph parameters and results respectively,
+ * work_amount is a number of elements along the innermost dimension to be processed by a single call.
+ */
+struct jit_snippets_call_args {
+    const void *src_ptrs[SNIPPETS_MAX_PTRS] = {};
+    void *dst_ptrs[SNIPPETS_MAX_PTRS] = {};
+    int64_t work_amount = 0;
+};
+
+using code_region = std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>>;
+
+///
+/// \brief    Kernel is the only entry point to the code produced by snippets generator
+///
+/// Loads Subgraph parameters and results pointers from jit_snippets_call_args to
+/// the general purpose registers assigned by ngraph::snippets::pass::AssignRegisters (R8 and above)
+/// and emits the Tiles (vector and scalar) it contains.
+/// Accepts {number of parameters, number of results} as the input registers.
+///
+class jit_kernel_emitter : public jit_emitter {
+public:
+    jit_kernel_emitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool,
+                   const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    code_region code;
+};
+
+///
+/// \brief    Tile is a loop over the innermost dimension of the Subgraph
+///
+/// Executes the code it contains while at least {increment} elements are left and decrements work amount by the increment.
+/// Accepts {increment, number of pointers} as the input registers.
+///
+class jit_tile_emitter : public jit_emitter {
+public:
+    jit_tile_emitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool,
+                   const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    code_region code;
+};
+
+class jit_nop_emitter : public jit_emitter {
+public:
+    jit_nop_emitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : jit_emitter(h, isa, n) {
+    }
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool,
+                   const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override {
+    }
+};
+
+///
+/// \brief    Broadcasts the first element of the register if the innermost dimension is broadcasted,
+///           otherwise the value is moved as is since outer dimensions broadcasting is handled by the scheduler
+///
+class jit_broadcast_move_emitter : public jit_emitter {
+public:
+    jit_broadcast_move_emitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 1; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool,
+                   const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+
+    bool use_broadcast;
+};
+
+class jit_scalar_emitter : public jit_emitter {
+public:
+    jit_scalar_emitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool,
+                   const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+
+    void register_table_entries() override;
+
+    table_entry_val_t value;
+};
+
+///
+/// \brief    Base class for the memory access emitters
+///
+/// The general purpose register which holds the pointer is taken from "effectiveAddress" runtime info
+/// set by ngraph::snippets::pass::AssignRegisters. Load and Store emitters post-increment the pointer
+/// unless the innermost dimension of the accessed tensor is broadcasted.
+///
+class jit_memory_emitter : public jit_emitter {
+public:
+    jit_memory_emitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+protected:
+    int64_t ea;
+};
+
+class jit_snippets_store_emitter : public jit_memory_emitter {
+public:
+    jit_snippets_store_emitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : jit_memory_emitter(h, isa, n) {
+    }
+
+    size_t get_inputs_num() const override { return 1; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool,
+                   const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+};
+
+class jit_snippets_scalar_store_emitter : public jit_memory_emitter {
+public:
+    jit_snippets_scalar_store_emitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : jit_memory_emitter(h, isa, n) {
+    }
+
+    size_t get_inputs_num() const override { return 1; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool,
+                   const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+};
+
+class jit_snippets_load_emitter : public jit_memory_emitter {
+public:
+    jit_snippets_load_emitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool,
+                   const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+
+    bool broadcast_innermost;
+};
+
+class jit_snippets_broadcast_load_emitter : public jit_memory_emitter {
+public:
+    jit_snippets_broadcast_load_emitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : jit_memory_emitter(h, isa, n) {
+    }
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool,
+                   const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+};
+
+class jit_snippets_scalar_load_emitter : public jit_memory_emitter {
+public:
+    jit_snippets_scalar_load_emitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool,
+                   const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    bool broadcast_innermost;
+};
+
+}   // namespace MKLDNNPlugin
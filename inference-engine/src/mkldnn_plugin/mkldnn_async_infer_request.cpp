@@ -5,6 +5,22 @@
 #include "mkldnn_async_infer_request.h"
 #include <memory>
 
+namespace {
+class StreamAffinityExecutor : public InferenceEngine::ITaskExecutor {
+public:
+    StreamAffinityExecutor(std::shared_ptr<InferenceEngine::CPUStreamsExecutor> streamsExecutor, int streamIndex)
+        : _streamsExecutor(std::move(streamsExecutor)), _streamIndex(streamIndex) {}
+
+    void run(InferenceEngine::Task task) override {
+        _streamsExecutor->run(std::move(task), _streamIndex);
+    }
+
+private:
+    std::shared_ptr<InferenceEngine::CPUStreamsExecutor> _streamsExecutor;
+    int _streamIndex;
+};
+}  // namespace
+
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                                const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
@@ -15,3 +31,8 @@ MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEn
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
     StopAndWait();
 }
+
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::setStreamAffinity(const std::shared_ptr<InferenceEngine::CPUStreamsExecutor>& streamsExecutor,
+                                                              int streamIndex) {
+    _pipeline.front().first = std::make_shared<StreamAffinityExecutor>(streamsExecutor, streamIndex);
+}
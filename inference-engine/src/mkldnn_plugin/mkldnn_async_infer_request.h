@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
 #include "mkldnn_infer_request.h"
 
 namespace MKLDNNPlugin {
@@ -17,6 +18,12 @@ public:
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                             const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
     ~MKLDNNAsyncInferRequest();
+
+    /**
+     * @brief Makes the request run preferably on the given stream, so the stream graph and the data in the caches of
+     * its cores are reused by the consecutive inferences
+     */
+    void setStreamAffinity(const std::shared_ptr<InferenceEngine::CPUStreamsExecutor>& streamsExecutor, int streamIndex);
 };
 
 }  // namespace MKLDNNPlugin
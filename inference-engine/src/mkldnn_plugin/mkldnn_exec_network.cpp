@@ -24,6 +24,10 @@
 #include <utility>
 #include <cstring>
 #include <ngraph/opsets/opset1.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/op/util/op_types.hpp>
+#include <snippets/op/subgraph.hpp>
+#include <ie_ngraph_utils.hpp>
 #include <transformations/utils/utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
@@ -57,12 +61,14 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const PrecomputedConstants::CPtr &precomputedConstants) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights),
+    _precomputedConstants(precomputedConstants),
         _network(network) {
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -114,6 +120,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         MKLDNNExecNetwork::GetGraph();
     }
+    _precomputedConstants.reset();
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
@@ -156,6 +163,7 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
+                graphLock._graph.setPrecomputedConstants(_precomputedConstants);
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
@@ -187,7 +195,13 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
 }
 
 InferenceEngine::IInferRequestInternal::Ptr MKLDNNExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+    auto asyncRequest = CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+    auto streamsExecutor = std::dynamic_pointer_cast<CPUStreamsExecutor>(_taskExecutor);
+    if (_cfg.streamAffinity && streamsExecutor) {
+        // the requests are distributed between the streams evenly, idle streams still steal the tasks of the busy ones
+        std::static_pointer_cast<MKLDNNAsyncInferRequest>(asyncRequest)->setStreamAffinity(streamsExecutor, _numStreamAffinities++);
+    }
+    return asyncRequest;
 }
 
 std::shared_ptr<ngraph::Function> MKLDNNExecNetwork::GetExecGraphInfo() {
@@ -286,7 +300,49 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &ne
     return true;
 }
 
+// Snippets are not a part of any opset, so their bodies are inlined back to the network before the serialization.
+// The names of the inlined ops are collected, so exactly the same ops are tokenized again on import.
+static InferenceEngine::CNNNetwork inlineSnippets(const InferenceEngine::CNNNetwork& network,
+                                                  std::unordered_set<std::string>& inlinedOps) {
+    const auto& ops = network.getFunction()->get_ordered_ops();
+    const bool hasSnippets = std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<ngraph::Node>& op) {
+        return ngraph::is_type<ngraph::snippets::op::Subgraph>(op);
+    });
+    if (!hasSnippets)
+        return network;
+
+    auto clonedNetwork = InferenceEngine::details::cloneNetwork(network);
+    for (const auto& op : clonedNetwork.getFunction()->get_ordered_ops()) {
+        const auto subgraph = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(op);
+        if (!subgraph)
+            continue;
+
+        const auto body = ngraph::clone_function(*subgraph->get_body());
+        for (const auto& bodyOp : body->get_ops()) {
+            if (!ngraph::op::is_parameter(bodyOp) && !ngraph::op::is_output(bodyOp))
+                inlinedOps.insert(bodyOp->get_friendly_name());
+        }
+        const auto& parameters = body->get_parameters();
+        for (size_t i = 0; i < parameters.size(); i++) {
+            parameters[i]->output(0).replace(subgraph->input_value(i));
+        }
+        const auto& results = body->get_results();
+        for (size_t i = 0; i < results.size(); i++) {
+            auto bodyOutput = results[i]->input_value(0);
+            bodyOutput.get_tensor().set_names(subgraph->output(i).get_tensor().get_names());
+            subgraph->output(i).replace(bodyOutput);
+        }
+    }
+    return clonedNetwork;
+}
+
 void MKLDNNExecNetwork::Export(std::ostream& modelStream) {
-    CNNNetworkSerializer serializer(modelStream, extensionManager);
-    serializer <<_network;
+    std::unordered_set<std::string> snippetsOps;
+    const auto network = inlineSnippets(_network, snippetsOps);
+    CNNNetworkSerializer serializer(modelStream, extensionManager, std::move(snippetsOps));
+    serializer << network;
+
+    // the graph constant path results (e.g. reordered weights) are stored as well, so they aren't computed again on import
+    PrecomputedConstantsSerializer constantsSerializer(modelStream);
+    constantsSerializer << GetGraph()._graph;
 }
@@ -34,7 +34,8 @@ public:
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const PrecomputedConstants::CPtr &precomputedConstants = nullptr);
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -54,6 +55,7 @@ protected:
     mutable std::mutex                          _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
+    std::atomic_int                             _numStreamAffinities = {0};
     std::string                                 _name;
     struct Graph : public MKLDNNGraph {
         std::mutex  _mutex;
@@ -66,6 +68,8 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<Graph>                   _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    // results of the constant path execution imported along with the network, are released once the graphs are created
+    PrecomputedConstants::CPtr                  _precomputedConstants;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -10,6 +10,8 @@
 #include <unordered_set>
 #include <limits>
 #include <fstream>
+#include <iostream>
+#include <sstream>
 #include <unordered_map>
 #include <memory>
 #include <utility>
@@ -17,6 +19,7 @@
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
 #include "mkldnn_graph_optimizer.h"
+#include "mkldnn_layout_optimizer.h"
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
 #include "memory_solver.hpp"
@@ -25,8 +28,10 @@
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_convert_node.h>
+#include <nodes/mkldnn_concat_node.h>
 
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -332,6 +337,8 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    InitExecLevels();
+
     Allocate();
 
     CreatePrimitives();
@@ -343,7 +350,14 @@ void MKLDNNGraph::InitGraph() {
 #endif
     ExtractConstantAndExecutableNodes();
 
+    if (!config.weightsCacheDir.empty())
+        persistentWeightsCache = std::make_shared<MKLDNNPersistentWeightsCache>(config.weightsCacheDir);
+
     ExecuteConstantNodesOnly();
+    // the precomputed data is copied to the graph memory, so it isn't needed anymore
+    precomputedConstants.reset();
+    persistentWeightsCache.reset();
+    constantDataHashes.clear();
 }
 
 void MKLDNNGraph::InitNodes() {
@@ -372,12 +386,57 @@ void MKLDNNGraph::InitDescriptors() {
         node->filterSupportedPrimitiveDescriptors();
     }
 
+    bool descriptorsRestored = false;
     for (auto &node : graphNodes) {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
-        node->selectOptimalPrimitiveDescriptor();
+        if (RestoreSelectedDescriptor(node))
+            descriptorsRestored = true;
+        else
+            node->selectOptimalPrimitiveDescriptor();
+    }
+
+    // the restored descriptors are already optimized
+    if (config.layoutOptimization && !descriptorsRestored) {
+        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "LayoutOptimization");
+        MKLDNNLayoutOptimizer layoutOptimizer(*this);
+        layoutOptimizer.apply();
+#ifdef CPU_DEBUG_CAPS
+        const auto& path = config.debugCaps.layoutsDumpPath;
+        if (!path.empty()) {
+            if (path == "cout") {
+                layoutOptimizer.dump(std::cout);
+            } else {
+                std::ofstream stream(path, std::ios_base::app);
+                layoutOptimizer.dump(stream);
+            }
+        }
+#endif
+    }
+
+    selectedDescriptors.clear();
+    for (auto &node : graphNodes) {
+        if (const auto selectedPd = node->getSelectedPrimitiveDescriptor())
+            selectedDescriptors[node->getName()] = {node->selectedPrimitiveDescriptorIndex, selectedPd->getImplementationType()};
     }
 }
 
+bool MKLDNNGraph::RestoreSelectedDescriptor(const MKLDNNNodePtr& node) {
+    if (!precomputedConstants)
+        return false;
+
+    const auto it = precomputedConstants->selectedDescriptors.find(node->getName());
+    if (it == precomputedConstants->selectedDescriptors.end())
+        return false;
+
+    const auto& supportedPds = node->getSupportedPrimitiveDescriptors();
+    const auto index = it->second.index;
+    if (index < 0 || static_cast<size_t>(index) >= supportedPds.size() || supportedPds[index].getImplementationType() != it->second.implType)
+        return false;
+
+    node->selectPrimitiveDescriptorByIndex(index);
+    return true;
+}
+
 void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::InitOptimalPrimitiveDescriptors");
     for (auto &node : graphNodes) {
@@ -386,6 +445,32 @@ void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
     }
 }
 
+void MKLDNNGraph::InitExecLevels() {
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    // nested parallel regions are efficiently supported by TBB only
+    parallelBranches = config.parallelBranches;
+#else
+    parallelBranches = false;
+#endif
+    for (auto &node : graphNodes) {
+        // the state of the memory nodes is passed between them without an edge, so their order must be kept
+        if (one_of(node->getType(), MemoryInput, MemoryOutput)) {
+            parallelBranches = false;
+        }
+    }
+    if (!parallelBranches)
+        return;
+
+    // the nodes are sorted topologically, so all the parents already have the level defined
+    for (auto &node : graphNodes) {
+        int level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            level = std::max(level, node->getParentEdgeAt(i)->getParent()->execLevel + 1);
+        }
+        node->execLevel = level;
+    }
+}
+
 void MKLDNNGraph::ExtractConstantAndExecutableNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExtractConstantAndExecutableNodes");
     for (const auto& graphNode : graphNodes) {
@@ -399,6 +484,17 @@ void MKLDNNGraph::ExtractConstantAndExecutableNodes() {
              */
             executableGraphNodes.emplace_back(graphNode);
     }
+
+    if (parallelBranches) {
+        for (const auto& node : executableGraphNodes) {
+            if (executableGraphLevels.size() <= static_cast<size_t>(node->execLevel))
+                executableGraphLevels.resize(node->execLevel + 1);
+            executableGraphLevels[node->execLevel].push_back(node);
+        }
+        executableGraphLevels.erase(std::remove_if(executableGraphLevels.begin(), executableGraphLevels.end(),
+                                                   [](const std::vector<MKLDNNNodePtr>& level) { return level.empty(); }),
+                                    executableGraphLevels.end());
+    }
 }
 
 void MKLDNNGraph::ExecuteConstantNodesOnly() const {
@@ -429,20 +525,174 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    const auto restoredNodes = RestorePrecomputedConstants();
+    std::unordered_set<const MKLDNNNode*> executedNodes;
+
     for (const auto &node : constantGraphNodes) {
+        if (restoredNodes.count(node.get()))
+            continue;
+
         if (weightsCache) {
             auto sharedOutputs = acquireSharedOutputs(node);
 
             if (std::get<0>(sharedOutputs) || std::get<1>(sharedOutputs)) {
                 ExecuteNode(node, stream);
+                executedNodes.insert(node.get());
 
                 for (auto & output : std::get<2>(sharedOutputs))
                     output->valid(true);
             }
         } else {
             ExecuteNode(node, stream);
+            executedNodes.insert(node.get());
         }
     }
+
+    if (persistentWeightsCache) {
+        // only the data computed by this graph is stored, the one restored or computed by the graph of another stream is skipped
+        for (const auto& edge : GetConstantOutputEdges()) {
+            if (!executedNodes.count(edge->getParent().get()))
+                continue;
+            const auto& memory = edge->getMemory();
+            persistentWeightsCache->write(GetPersistentWeightsKey(edge), memory.GetData(), memory.GetSize());
+        }
+    }
+}
+
+std::string PrecomputedConstants::describe(const MKLDNNMemory& memory) {
+    const auto& desc = memory.getDesc();
+    return std::string(desc.getPrecision().name()) + "_" + desc.serializeFormat() + "_" + std::to_string(memory.GetSize());
+}
+
+std::vector<MKLDNNEdgePtr> MKLDNNGraph::GetConstantOutputEdges() const {
+    std::vector<MKLDNNEdgePtr> edges;
+    for (const auto& node : constantGraphNodes) {
+        if (node->getType() == Input)
+            continue;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            const auto edge = node->getChildEdgeAt(i);
+            if (!edge->getChild()->isConstant() && edge->getMemory().getDesc().isDefined())
+                edges.push_back(edge);
+        }
+    }
+    return edges;
+}
+
+bool MKLDNNGraph::RestorePrecomputedConstant(const MKLDNNEdgePtr& edge) const {
+    const auto& memory = edge->getMemory();
+    if (!memory.getDesc().isDefined())
+        return false;
+
+    MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr sharedMemory;
+    if (edge->isUseExternalMemory()) {
+        // the memory is shared between the graphs of different streams, so it may be restored already
+        sharedMemory = weightsCache->get(edge->name());
+        if (sharedMemory->isValid())
+            return true;
+    }
+
+    auto restore = [&](const void* data) {
+        cpu_memcpy(memory.GetData(), data, memory.GetSize());
+    };
+
+    bool restored = false;
+    if (precomputedConstants) {
+        const auto found = precomputedConstants->edges.find(edge->name());
+        if (found != precomputedConstants->edges.end() && found->second.desc == PrecomputedConstants::describe(memory)) {
+            restore(found->second.data.data());
+            edge->getParent()->addPrecomputedOutput();
+            restored = true;
+        }
+    }
+    // the data of the constant inputs is a part of the network itself, so it is never stored in the persistent cache
+    if (!restored && persistentWeightsCache && edge->getParent()->getType() != Input) {
+        restored = persistentWeightsCache->read(GetPersistentWeightsKey(edge), memory.GetSize(), restore);
+        if (restored)
+            edge->getParent()->addPersistentCacheOutput();
+    }
+
+    if (restored && sharedMemory)
+        sharedMemory->valid(true);
+    return restored;
+}
+
+uint64_t MKLDNNGraph::GetPersistentWeightsKey(const MKLDNNEdgePtr& edge) const {
+    // the key is computed from the content only: the data and descriptors of the constant inputs, the operations and
+    // connections of the constant subgraph producing the data and the layout of the result. The names of the nodes
+    // and edges aren't used, so the same weights prepared for the same ISA are found by any network.
+    // The plugin and oneDNN builds are a part of the key as well, since the kernels producing the data may change.
+    std::vector<MKLDNNNodePtr> subgraph;
+    std::unordered_set<const MKLDNNNode*> visited;
+    std::vector<MKLDNNNodePtr> stack = {edge->getParent()};
+    while (!stack.empty()) {
+        const auto node = stack.back();
+        stack.pop_back();
+        if (!visited.insert(node.get()).second)
+            continue;
+        subgraph.push_back(node);
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            stack.push_back(node->getParentEdgeAt(i)->getParent());
+    }
+    std::sort(subgraph.begin(), subgraph.end(), [](const MKLDNNNodePtr& l, const MKLDNNNodePtr& r) {
+        return l->execIndex < r->execIndex;
+    });
+    std::unordered_map<const MKLDNNNode*, size_t> positions;
+    for (size_t i = 0; i < subgraph.size(); i++)
+        positions[subgraph[i].get()] = i;
+
+    const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    std::stringstream desc;
+    const auto dnnlVersion = dnnl_version();
+    desc << CI_BUILD_NUMBER << ";" << dnnlVersion->major << "." << dnnlVersion->minor << "." << dnnlVersion->patch << "."
+         << dnnlVersion->hash << ";";
+    desc << static_cast<int>(dnnl::get_effective_cpu_isa()) << ";" << edge->getInputNum() << ";"
+         << PrecomputedConstants::describe(edge->getMemory());
+    for (const auto& node : subgraph) {
+        desc << ";" << node->getTypeStr();
+        if (const auto selectedPd = node->getSelectedPrimitiveDescriptor())
+            desc << ":" << static_cast<uint64_t>(selectedPd->getImplementationType());
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto parentEdge = node->getParentEdgeAt(i);
+            desc << ":" << positions[parentEdge->getParent().get()] << "." << parentEdge->getInputNum() << "."
+                 << PrecomputedConstants::describe(parentEdge->getMemory());
+        }
+        if (node->getType() == Input) {
+            const auto memory = std::static_pointer_cast<MKLDNNInputNode>(node)->getMemoryPtr();
+            auto found = constantDataHashes.find(node.get());
+            if (found == constantDataHashes.end()) {
+                const auto hash = hashFunc.hash(static_cast<const unsigned char*>(memory->GetData()), memory->GetSize());
+                found = constantDataHashes.emplace(node.get(), hash).first;
+            }
+            desc << ":" << PrecomputedConstants::describe(*memory) << ":" << found->second;
+        }
+    }
+    const auto str = desc.str();
+    return hashFunc.hash(reinterpret_cast<const unsigned char*>(str.data()), str.size());
+}
+
+std::unordered_set<const MKLDNNNode*> MKLDNNGraph::RestorePrecomputedConstants() const {
+    std::unordered_set<const MKLDNNNode*> restoredNodes;
+    if (!precomputedConstants && !persistentWeightsCache)
+        return restoredNodes;
+
+    // Constant nodes are visited in the reverse topological order, so all the consumers of a node are already processed.
+    // The node isn't executed if all its non-constant consumers get data restored and all its constant consumers aren't executed.
+    for (auto it = constantGraphNodes.rbegin(); it != constantGraphNodes.rend(); ++it) {
+        const auto& node = *it;
+        bool isRequired = false;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            const auto edge = node->getChildEdgeAt(i);
+            const auto child = edge->getChild();
+            if (child->isConstant()) {
+                isRequired |= restoredNodes.count(child.get()) == 0;
+            } else {
+                isRequired |= !RestorePrecomputedConstant(edge);
+            }
+        }
+        if (!isRequired)
+            restoredNodes.insert(node.get());
+    }
+    return restoredNodes;
 }
 
 static bool isReorderAvailable(const MemoryDesc& parentDesc, const MemoryDesc& childDesc, const mkldnn::engine& eng) {
@@ -539,6 +789,8 @@ static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graph
     edge_cluster_idx_map_t edge_cluster_indices;
 
     for (auto &edge : graphEdges) {
+        // The edges with bounded dynamic dimensions are placed by their upper bound. The unbounded ones own their
+        // memory, which grows up to the largest size seen at runtime (see MKLDNNMemory::redefineDesc).
         if (!edge->hasDefinedMaxSize())
             continue;
 
@@ -619,8 +871,9 @@ void MKLDNNGraph::AllocateWithReuse() {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            // the nodes of one level may be executed concurrently, so the level is used as the time stamp then
+            int e_start = parallelBranches ? edge->getParent()->execLevel : edge->getParent()->execIndex;
+            int e_finish = parallelBranches ? edge->getChild()->execLevel : edge->getChild()->execIndex;
 
             if (!edge->hasDefinedMaxSize()) {
                 IE_THROW() << "Can not allocate memory since the size is undefined.";
@@ -713,6 +966,7 @@ void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
     for (auto& node : graphNodes) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
+        node->setPrimitivesCacheCapacity(config.rtCacheCapacity);
         node->createPrimitive();
     }
 }
@@ -853,14 +1107,48 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
 
     mkldnn::stream stream(eng);
 
-    for (const auto& node : executableGraphNodes) {
-        VERBOSE(node, config.debugCaps.verbose);
-        PERF(node, config.collectPerfCounters);
+    const HwPerfCounters* hwCounters = nullptr;
+    if (config.collectPerfCounters && config.collectHwPerfCounters) {
+        if (!hwPerfCounters) {
+            hwPerfCounters = std::make_shared<HwPerfCounters>();
+            // the counters of a thread may be opened only by the thread itself, so the workers are attached once
+            // by the threads themselves
+            hwPerfCounters->attachWorkers();
+        }
+        hwCounters = hwPerfCounters.get();
+    }
 
-        if (request)
-            request->ThrowIfCanceled();
+    if (parallelBranches) {
+        for (const auto& level : executableGraphLevels) {
+            if (request)
+                request->ThrowIfCanceled();
 
-        ExecuteNode(node, stream);
+            if (level.size() == 1) {
+                VERBOSE(level.front(), config.debugCaps.verbose);
+                PERF(level.front(), config.collectPerfCounters, hwCounters);
+                ExecuteNode(level.front(), stream);
+            } else {
+                // the nodes of the level are independent, so they share the threads of the stream with each other.
+                // Each node is timed by the task executing it, so its time doesn't include the other nodes of the level
+                parallel_for(level.size(), [&](size_t i) {
+                    mkldnn::stream localStream(eng);
+                    VERBOSE(level[i], config.debugCaps.verbose);
+                    PERF(level[i], config.collectPerfCounters, hwCounters);
+                    ExecuteNode(level[i], localStream);
+                    level[i]->concurrentExecutionsCount++;
+                });
+            }
+        }
+    } else {
+        for (const auto& node : executableGraphNodes) {
+            VERBOSE(node, config.debugCaps.verbose);
+            PERF(node, config.collectPerfCounters, hwCounters);
+
+            if (request)
+                request->ThrowIfCanceled();
+
+            ExecuteNode(node, stream);
+        }
     }
 
     if (infer_count != -1) infer_count++;
@@ -1288,6 +1576,49 @@ void MKLDNNGraph::EnforceBF16() {
     }
 }
 
+bool MKLDNNGraph::CanChangeChildEdgesPtr(const MKLDNNNodePtr& node) {
+    for (auto& childEdge : node->getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << node->getName() << " contains empty child edge";
+
+        auto& child = ce->getChild();
+
+        if (child->isConstant())
+            return false;
+
+        if (child->getType() == Concatenation && dynamic_cast<MKLDNNConcatNode*>(child.get())->isOptimized())
+            return false;
+
+        // Cannot be in-place before split because split is using different ptrs without offsets
+        if (child->getType() == Split)
+            return false;
+
+        if (child->isInPlace())
+            return false;
+
+        for (auto& edge : child->getChildEdges()) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << child->getName() << " contains empty child edge";
+
+            if (e->getMemory().GetPrimitive().get_data_handle() == ce->getMemory().GetPrimitive().get_data_handle())
+                return false;
+        }
+    }
+    return true;
+}
+
+void MKLDNNGraph::ChangeChildEdgesPtr(const MKLDNNNodePtr& node, void* ptr) {
+    for (auto& childEdge : node->getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << node->getName() << " contains empty child edge";
+
+        ce->getMemory().GetPrimitivePtr()->set_data_handle(ptr);
+    }
+}
+
 std::shared_ptr<ngraph::Function> MKLDNNGraph::dump() const {
     return dump_graph_as_ie_ngraph_net(*this);
 }
@@ -15,9 +15,41 @@
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace MKLDNNPlugin {
 class MKLDNNInferRequest;
+
+/**
+ * Results of the graph constant path execution (e.g. weights reordered to the layouts selected for the graph)
+ * keyed by the names of the edges connecting constant and non-constant parts of the graph.
+ * Are stored along with the exported network, so the constant path is not executed again on import.
+ */
+struct PrecomputedConstants {
+    typedef std::shared_ptr<PrecomputedConstants> Ptr;
+    typedef std::shared_ptr<const PrecomputedConstants> CPtr;
+
+    struct Data {
+        // precision, format and size of the memory the data was taken from, used to validate the data on restore
+        std::string desc;
+        std::vector<uint8_t> data;
+    };
+
+    std::unordered_map<std::string, Data> edges;
+
+    struct SelectedDescriptor {
+        int index;
+        // the type of the selected implementation, used to validate the index on restore
+        impl_desc_type implType;
+    };
+
+    // primitive descriptors selected for the nodes keyed by the node names, so the selection isn't done again on import
+    std::unordered_map<std::string, SelectedDescriptor> selectedDescriptors;
+
+    static std::string describe(const MKLDNNMemory& memory);
+};
+
 class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
@@ -172,6 +204,17 @@ public:
      */
     bool InsertNode(MKLDNNNodePtr parent, MKLDNNNodePtr child, MKLDNNNodePtr node, int parentPort, int childPort, bool initNode = false);
 
+    /**
+     * @brief Checks whether the memory of the node output edges may be replaced by an external buffer, i.e. the buffer
+     * is neither shared in-place with the consumers nor written by them
+     */
+    static bool CanChangeChildEdgesPtr(const MKLDNNNodePtr& node);
+
+    /**
+     * @brief Replaces the data handle of the memory of all the node output edges
+     */
+    static void ChangeChildEdgesPtr(const MKLDNNNodePtr& node, void* ptr);
+
     std::shared_ptr<ngraph::Function> dump() const;
 
     void ResetInferCount() { infer_count = 0; }
@@ -186,6 +229,23 @@ public:
         return graphHasDynamicInput;
     }
 
+    void setPrecomputedConstants(PrecomputedConstants::CPtr constants) {
+        precomputedConstants = constants;
+    }
+
+    /**
+     * @brief Returns the edges which memory is produced by the constant path and consumed by non-constant nodes.
+     * Edges coming directly from the constant Input nodes are omitted since their data is a part of the network itself.
+     */
+    std::vector<MKLDNNEdgePtr> GetConstantOutputEdges() const;
+
+    /**
+     * @brief Returns the primitive descriptors selected for the nodes when the graph was initialized
+     */
+    const std::unordered_map<std::string, PrecomputedConstants::SelectedDescriptor>& GetSelectedDescriptors() const {
+        return selectedDescriptors;
+    }
+
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
 
@@ -226,14 +286,19 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    bool RestoreSelectedDescriptor(const MKLDNNNodePtr& node);
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
+    void InitExecLevels();
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
     void ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const;
     void ExecuteConstantNodesOnly() const;
+    bool RestorePrecomputedConstant(const MKLDNNEdgePtr& edge) const;
+    uint64_t GetPersistentWeightsKey(const MKLDNNEdgePtr& edge) const;
+    std::unordered_set<const MKLDNNNode*> RestorePrecomputedConstants() const;
 
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
@@ -249,6 +314,18 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<MKLDNNNodePtr> constantGraphNodes;
     std::vector<MKLDNNNodePtr> executableGraphNodes;
+    // executable nodes grouped by the execution level, filled only if the independent branches are run concurrently
+    std::vector<std::vector<MKLDNNNodePtr>> executableGraphLevels;
+    bool parallelBranches = false;
+
+    // created on the first inference with the hardware performance counters enabled
+    std::shared_ptr<HwPerfCounters> hwPerfCounters;
+
+    PrecomputedConstants::CPtr precomputedConstants;
+    std::unordered_map<std::string, PrecomputedConstants::SelectedDescriptor> selectedDescriptors;
+    MKLDNNPersistentWeightsCache::Ptr persistentWeightsCache;
+    // hashes of the constant inputs data, which are used in the keys of the persistent weights cache
+    mutable std::unordered_map<const MKLDNNNode*, uint64_t> constantDataHashes;
 
     void EnforceBF16();
 };
@@ -9,6 +9,7 @@
 #include "exec_graph_info.hpp"
 #include "ie_common.h"
 #include "mkldnn_debug.h"
+#include "nodes/mkldnn_reference_node.h"
 #include <ngraph/variant.hpp>
 #include "ngraph/ngraph.hpp"
 #include <ngraph/pass/manager.hpp>
@@ -104,10 +105,62 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
         serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
 
+    const auto hwCounters = node->PerfCounter().hwAvg();
+    if (hwCounters.cycles != 0) {
+        serialization_info["hwCycles"] = std::to_string(hwCounters.cycles);
+        serialization_info["hwInstructions"] = std::to_string(hwCounters.instructions);
+        serialization_info["hwLlcMisses"] = std::to_string(hwCounters.llcMisses);
+        // every LLC miss is assumed to transfer a cache line from the memory, bytes per microsecond are MB/s
+        const auto avgTime = node->PerfCounter().avg();
+        if (avgTime != 0)
+            serialization_info["hwMemBandwidthMBps"] = std::to_string(hwCounters.llcMisses * 64 / avgTime);
+    }
+
     serialization_info[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 
+    // the nodes of one level may be executed concurrently
+    if (node->getExecLevel() >= 0) {
+        serialization_info["execLevel"] = std::to_string(node->getExecLevel());
+        serialization_info["concurrentExecutions"] = std::to_string(node->getConcurrentExecutionsCount());
+    }
+
     serialization_info[ExecGraphInfoSerialization::RUNTIME_PRECISION] = node->getRuntimePrecision().name();
 
+    if (node->isDynamicNode()) {
+        const auto& cacheStats = node->getPrimitivesCacheStatistics();
+        serialization_info["primitivesCacheHits"] = std::to_string(cacheStats.hits);
+        serialization_info["primitivesCacheMisses"] = std::to_string(cacheStats.misses);
+        serialization_info["outputMemoryReallocations"] = std::to_string(node->getOutputMemoryReallocationsCount());
+    }
+
+    if (node->getPrecomputedOutputsCount() != 0) {
+        serialization_info["precomputedOutputs"] = std::to_string(node->getPrecomputedOutputsCount());
+    }
+    if (node->getPersistentCacheOutputsCount() != 0) {
+        serialization_info["persistentWeightsCacheHits"] = std::to_string(node->getPersistentCacheOutputsCount());
+    }
+
+    // Flags the operations which have no native implementation and are evaluated by the reference kernels
+    if (node->getType() == Reference) {
+        const auto refNode = std::dynamic_pointer_cast<MKLDNNReferenceNode>(node);
+        if (refNode) {
+            const auto& typeInfo = refNode->getReferenceOp()->get_type_info();
+            serialization_info["referenceFallback"] = std::string(typeInfo.name) + " (" + typeInfo.get_version() + ")";
+            // the path taken on the last inference, it depends on the runtime shapes
+            switch (refNode->getLastExecutionPath()) {
+            case MKLDNNReferenceNode::ExecutionPath::Parallel:
+                serialization_info["referenceFallbackExecution"] = "parallel";
+                break;
+            case MKLDNNReferenceNode::ExecutionPath::Sequential:
+                serialization_info["referenceFallbackExecution"] = "sequential";
+                break;
+            default:
+                serialization_info["referenceFallbackExecution"] = "not executed";
+                break;
+            }
+        }
+    }
+
     return serialization_info;
 }
 
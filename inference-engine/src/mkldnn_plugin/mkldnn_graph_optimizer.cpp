@@ -15,6 +15,7 @@
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
+#include "nodes/mkldnn_color_convert_node.h"
 #include <nodes/mkldnn_transpose_node.h>
 #include "nodes/mkldnn_interpolate_node.h"
 #include "nodes/mkldnn_reduce_node.h"
@@ -66,6 +67,10 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseMultiplyAndAdd(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseColorConvertAndSimpleOperation");
+    FuseColorConvertAndSimpleOperation(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseDeconvolutionAndSimpleOperation");
     FuseDeconvolutionAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
@@ -130,6 +135,10 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseMVNAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvertAndInterpolate");
+    FuseConvertAndInterpolate(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseInterpolateAndSimpleOperation");
     FuseInterpolateAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
@@ -1264,6 +1273,97 @@ void MKLDNNGraphOptimizer::FuseMVNAndSimpleOperation(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseColorConvertAndSimpleOperation(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableParentNode = [](MKLDNNNodePtr node) {
+        return node->getType() == ColorConvert && node->getChildEdges().size() == 1;
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSuitableParentNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!parentNode->canFuse(childNode)) {
+            parent++;
+            continue;
+        }
+
+        auto colorConvertNode = std::dynamic_pointer_cast<MKLDNNColorConvertNode>(parentNode);
+        if (!colorConvertNode) {
+            IE_THROW() << "Cannot cast " << parentNode->getName() << " to MKLDNNColorConvertNode";
+        }
+
+        // the eltwise operation is applied by the kernel as the per-channel affine transformation of the result
+        if (childNode->getType() == Eltwise) {
+            std::vector<float> scales, shifts;
+            std::tie(scales, shifts) = childNode->getScalesAndShifts(parentNode.get());
+            colorConvertNode->appendScaleShift(scales, shifts);
+        }
+
+        childNode->fuseInto(parentNode);
+
+        if (childNode->getType() == Eltwise) {
+            auto parentEdges = childNode->parentEdges;
+            for (auto &parentEdge : parentEdges) {
+                auto p_edge = parentEdge.lock();
+                if (p_edge->getParent() == parentNode)
+                    continue;
+
+                graph.RemoveEdge(p_edge);
+            }
+        }
+
+        graph.DropNode(childNode);
+    }
+}
+
+// The preprocessing of an image input usually starts with the Convert of the u8 data to f32 followed by the resize (and
+// the layout Transpose which is merged with the Reorder later). Interpolate reads the integer data itself and computes
+// in f32, so the Convert is dropped to avoid the extra pass over the full-resolution input.
+void MKLDNNGraphOptimizer::FuseConvertAndInterpolate(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableConvert = [](MKLDNNNodePtr node) {
+        return node->getType() == Convert && node->getChildEdges().size() == 1 &&
+               one_of(node->getOriginalInputPrecisionAtPort(0), Precision::U8, Precision::I8) &&
+               node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32;
+    };
+
+    for (auto &convertNode : graphNodes) {
+        if (!isSuitableConvert(convertNode))
+            continue;
+
+        auto childNode = convertNode->getChildEdgeAt(0)->getChild();
+        if (convertNode->getChildEdgeAt(0)->getOutputNum() != 0)
+            continue;
+
+        MKLDNNNodePtr transposeNode;
+        if (childNode->getType() == Transpose && childNode->getChildEdges().size() == 1 &&
+                childNode->getChildEdgeAt(0)->getOutputNum() == 0) {
+            transposeNode = childNode;
+            childNode = transposeNode->getChildEdgeAt(0)->getChild();
+        }
+
+        if (childNode->getType() != Interpolate)
+            continue;
+
+        const auto srcPrecision = convertNode->getOriginalInputPrecisionAtPort(0);
+        if (transposeNode) {
+            transposeNode->setOriginalInputPrecisionAtPort(0, srcPrecision);
+            transposeNode->setOriginalOutputPrecisionAtPort(0, srcPrecision);
+        }
+        childNode->setOriginalInputPrecisionAtPort(0, srcPrecision);
+
+        graph.DropNode(convertNode);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseInterpolateAndSimpleOperation(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -139,30 +139,59 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
     }
 }
 
+static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
+    edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
+}
+
+// Checks that the memory of the edge is written by its parent only, so the edge may be bound to another buffer
+static bool canChangeParentEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &parentEdge) {
+    void* defaultPtr = parentEdge->getMemory().GetPrimitivePtr()->get_data_handle();
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = parentEdge->getParent();
+    MKLDNNPlugin::MKLDNNNodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace()) {
+            return false;
+        }
+
+        auto& parentEdges = parent->getParentEdges();
+        for (auto& edge : parentEdges) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+
+            if (e->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
+                parent = e->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return true;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
+    // The memory nodes of the graph work with the state buffers of the request directly: the current value is read
+    // by the output edges of MemoryInput node and the new one is written to the second buffer of the state by the
+    // input edge of MemoryOutput node. The edges are bound to the buffers when possible, otherwise the nodes copy
+    // the values, and the buffers are swapped after the inference
     for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+        if (node->getType() == MemoryOutput) {
+            auto cur_node = dynamic_cast<MKLDNNMemoryOutputNode*>(node.get());
             if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
+                IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryOutputNode";
             }
-            auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                if (state->GetName() == cur_node->getId()) {
+                    auto writePtr = state->getWritePtr();
+                    auto parentEdge = node->getParentEdgeAt(0);
+                    if (parentEdge->getMemory().GetPrimitive().get_data_handle() != writePtr &&
+                        canChangeParentEdgePtr(parentEdge)) {
+                        changeEdgePtr(parentEdge, writePtr);
+                    }
                 }
             }
         }
-    }
-}
-
-void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
-    for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
             auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
             if (!cur_node) {
@@ -171,18 +200,25 @@ void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
+                    auto readPtr = state->getReadPtr();
+                    cur_node->bindState(readPtr, state->getWritePtr());
 
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    if (node->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() != readPtr &&
+                        MKLDNNGraph::CanChangeChildEdgesPtr(node)) {
+                        MKLDNNGraph::ChangeChildEdgesPtr(node, readPtr);
+                    }
                 }
             }
         }
     }
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
+    for (const auto& state : memoryStates) {
+        state->commit();
+    }
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::redefineMemoryForInputNodes() {
     const auto cpuInputNodes = graph->GetInputNodesMap();
 
@@ -499,10 +535,6 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
     }
 }
 
-static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
-    edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
-}
-
 void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
     for (auto& it : externalPtr) {
         const auto& inputNodesMap = graph->GetInputNodesMap();
@@ -511,60 +543,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
             MKLDNNNodePtr inputNodePtr = input->second;
             if (inputNodePtr->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
-            auto& childEdges = inputNodePtr->getChildEdges();
             // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (auto& childEdge : childEdges) {
-                auto ce = childEdge.lock();
-                if (!ce)
-                    IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
-
-                auto& child = ce->getChild();
-
-                if (child->isConstant()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                if (child->getType() == Concatenation && dynamic_cast<MKLDNNConcatNode*>(child.get())->isOptimized()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                // Cannot be in-place before split because split is using different ptrs without offsets
-                if (child->getType() == Split) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                if (child->isInPlace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                auto& edges = child->getChildEdges();
-                for (auto& edge : edges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << child->getName() << " contains empty child edge";
-
-                    if (e->getMemory().GetPrimitive().get_data_handle() == ce->getMemory().GetPrimitive().get_data_handle()) {
-                        canBeInPlace = false;
-                        break;
-                    }
-                }
-
-                if (!canBeInPlace)
-                    break;
-            }
-            if (canBeInPlace) {
-                for (auto& edge : childEdges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
-
-                    changeEdgePtr(e, it.second);
-                }
+            if (MKLDNNGraph::CanChangeChildEdgesPtr(inputNodePtr)) {
+                MKLDNNGraph::ChangeChildEdgesPtr(inputNodePtr, it.second);
             }
 
             continue;
@@ -577,31 +558,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
             if (parentEdge->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
 
-            bool canBeInPlace = true;
-            void* defaultPtr = parentEdge->getMemory().GetPrimitivePtr()->get_data_handle();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = parentEdge->getParent();
-            MKLDNNNodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                auto& parentEdges = parent->getParentEdges();
-                for (auto& edge : parentEdges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
-
-                    if (e->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
-                        parent = e->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
+            if (canChangeParentEdgePtr(parentEdge))
                 changeEdgePtr(parentEdge, it.second);
             continue;
         }
@@ -627,7 +584,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBatch(int new_batch) {
 }
 
 std::vector<InferenceEngine::IVariableStateInternal::Ptr> MKLDNNPlugin::MKLDNNInferRequest::QueryState() {
-    return memoryStates;
+    return {memoryStates.begin(), memoryStates.end()};
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::SetAsyncRequest(MKLDNNAsyncInferRequest* asyncRequest) {
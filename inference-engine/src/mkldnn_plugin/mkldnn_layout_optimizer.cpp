@@ -0,0 +1,184 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_layout_optimizer.h"
+#include "utils/general_utils.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+// the edges of unknown size are assumed to be of the typical activation size
+constexpr double dynamicEdgeBytes = 1 << 20;
+// the penalty for each step down the priority list of the implementations, relative to the size of the node output
+constexpr double implRankCost = 8.0;
+// the reselection is stopped if the graph converges earlier
+constexpr int maxSweeps = 4;
+
+bool isLayoutCompatible(const MemoryDesc& parentDesc, const MemoryDesc& childDesc) {
+    if (childDesc.isCompatible(parentDesc))
+        return true;
+    if (parentDesc.isDefined() && childDesc.isDefined())
+        return false;
+    // the undefined strides and offsets are resolved by initOptimalPrimitiveDescriptor to match the neighbour
+    if (parentDesc.getPrecision() != childDesc.getPrecision() || parentDesc.getShape().getRank() != childDesc.getShape().getRank())
+        return false;
+    for (auto layout : {LayoutType::ncsp, LayoutType::nspc, LayoutType::nCsp8c, LayoutType::nCsp16c}) {
+        if (parentDesc.hasLayoutType(layout) && childDesc.hasLayoutType(layout))
+            return true;
+    }
+    return false;
+}
+
+double getBytes(const MemoryDesc& desc) {
+    const auto& shape = desc.getShape();
+    if (!shape.isStatic())
+        return dynamicEdgeBytes;
+    return static_cast<double>(shape.getElementsCount()) * desc.getPrecision().size();
+}
+
+const MemoryDesc* getOutputDesc(const NodeDesc* pd, int port) {
+    if (pd == nullptr || pd->getConfig().outConfs.empty())
+        return nullptr;
+    if (port < 0 || port >= static_cast<int>(pd->getConfig().outConfs.size()))
+        port = 0;
+    return pd->getConfig().outConfs[port].desc.get();
+}
+
+const MemoryDesc* getInputDesc(const NodeDesc* pd, int port) {
+    if (pd == nullptr || port < 0 || port >= static_cast<int>(pd->getConfig().inConfs.size()))
+        return nullptr;
+    return pd->getConfig().inConfs[port].desc.get();
+}
+
+// reading and writing the tensor, the reorders of the constant inputs are executed once on the network loading
+double getReorderCost(const MKLDNNEdgePtr& edge, const NodeDesc* parentPd, const NodeDesc* childPd) {
+    if (edge->getParent()->isConstant() && !edge->getChild()->isConstant())
+        return 0;
+    const auto parentDesc = getOutputDesc(parentPd, edge->getInputNum());
+    const auto childDesc = getInputDesc(childPd, edge->getOutputNum());
+    if (parentDesc == nullptr || childDesc == nullptr || isLayoutCompatible(*parentDesc, *childDesc))
+        return 0;
+    return 2 * getBytes(*parentDesc);
+}
+
+std::string getLayouts(const std::vector<PortConfig>& confs) {
+    std::string layouts;
+    for (const auto& conf : confs) {
+        if (!layouts.empty())
+            layouts += ",";
+        layouts += conf.desc->serializeFormat();
+    }
+    return layouts;
+}
+
+}  // namespace
+
+bool MKLDNNLayoutOptimizer::isOptimizable(const MKLDNNNodePtr& node) const {
+    // the inputs and outputs keep the user layouts, while concat and split choose the descriptors for the in-place
+    // memory sharing on their own
+    if (one_of(node->getType(), Input, Output, Concatenation, Split, Reorder, MemoryInput, MemoryOutput))
+        return false;
+    return node->getSupportedPrimitiveDescriptors().size() > 1 && node->getSelectedPrimitiveDescriptor() != nullptr;
+}
+
+double MKLDNNLayoutOptimizer::getImplCost(const MKLDNNNodePtr& node, int pdIndex) const {
+    const auto& pds = node->getSupportedPrimitiveDescriptors();
+    const auto& priority = node->getPrimitivesPriority();
+    auto getRank = [&](const NodeDesc& pd) {
+        return static_cast<size_t>(std::distance(priority.begin(),
+                                                 std::find(priority.begin(), priority.end(), pd.getImplementationType())));
+    };
+    size_t bestRank = std::numeric_limits<size_t>::max();
+    for (const auto& pd : pds) {
+        bestRank = std::min(bestRank, getRank(pd));
+    }
+
+    double outputBytes = 0;
+    for (const auto& conf : pds[pdIndex].getConfig().outConfs) {
+        outputBytes += getBytes(*conf.desc);
+    }
+    return implRankCost * outputBytes * static_cast<double>(getRank(pds[pdIndex]) - bestRank);
+}
+
+double MKLDNNLayoutOptimizer::getCost(const MKLDNNNodePtr& node, int pdIndex) const {
+    const auto& pd = node->getSupportedPrimitiveDescriptors()[pdIndex];
+    double cost = getImplCost(node, pdIndex);
+    for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+        const auto edge = node->getParentEdgeAt(i);
+        cost += getReorderCost(edge, edge->getParent()->getSelectedPrimitiveDescriptor(), &pd);
+    }
+    for (const auto& weakEdge : node->getChildEdges()) {
+        const auto edge = weakEdge.lock();
+        if (!edge)
+            continue;
+        cost += getReorderCost(edge, &pd, edge->getChild()->getSelectedPrimitiveDescriptor());
+    }
+    return cost;
+}
+
+double MKLDNNLayoutOptimizer::getReordersCost() const {
+    double cost = 0;
+    for (const auto& node : graph.GetNodes()) {
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto edge = node->getParentEdgeAt(i);
+            cost += getReorderCost(edge, edge->getParent()->getSelectedPrimitiveDescriptor(),
+                                   node->getSelectedPrimitiveDescriptor());
+        }
+    }
+    return cost;
+}
+
+void MKLDNNLayoutOptimizer::apply() {
+    initialReordersCost = getReordersCost();
+
+    // the descriptor of every node is reselected with the ones of the neighbours fixed, until nothing changes
+    for (int sweep = 0; sweep < maxSweeps; sweep++) {
+        bool changed = false;
+        for (const auto& node : graph.GetNodes()) {
+            if (!isOptimizable(node))
+                continue;
+            const auto& pds = node->getSupportedPrimitiveDescriptors();
+            const int selected = static_cast<int>(node->getSelectedPrimitiveDescriptor() - pds.data());
+            int best = selected;
+            double bestCost = getCost(node, selected);
+            for (int i = 0; i < static_cast<int>(pds.size()); i++) {
+                if (i == selected || pds[i].getConfig().inConfs.size() > node->getParentEdges().size())
+                    continue;
+                const double cost = getCost(node, i);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    best = i;
+                }
+            }
+            if (best != selected) {
+                node->selectPrimitiveDescriptorByIndex(best);
+                reselectedNodes++;
+                changed = true;
+            }
+        }
+        if (!changed)
+            break;
+    }
+
+    finalReordersCost = getReordersCost();
+}
+
+void MKLDNNLayoutOptimizer::dump(std::ostream& stream) const {
+    stream << "Layout optimization: " << reselectedNodes << " descriptors reselected, estimated reorder traffic "
+           << std::fixed << std::setprecision(3) << initialReordersCost / (1 << 20) << " MB -> "
+           << finalReordersCost / (1 << 20) << " MB" << std::endl;
+    for (const auto& node : graph.GetNodes()) {
+        const auto pd = node->getSelectedPrimitiveDescriptor();
+        if (pd == nullptr)
+            continue;
+        stream << node->getName() << " (" << NameFromType(node->getType()) << ") "
+               << impl_type_to_string(pd->getImplementationType()) << ": "
+               << getLayouts(pd->getConfig().inConfs) << " -> " << getLayouts(pd->getConfig().outConfs) << std::endl;
+    }
+}
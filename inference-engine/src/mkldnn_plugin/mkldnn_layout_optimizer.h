@@ -0,0 +1,46 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_graph.h"
+#include <ostream>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Refines the primitive descriptors selected by the nodes one by one. Each node picks the descriptor matching its
+ * parents, so the layout mismatches with the children are left to the reorders. The optimizer revisits the choice of
+ * every node taking both the parents and the children into account and minimizes the estimated cost of the graph:
+ * the bytes moved by the reorders between the nodes plus the penalty for the implementations of lower priority.
+ */
+class MKLDNNLayoutOptimizer {
+public:
+    explicit MKLDNNLayoutOptimizer(MKLDNNGraph& graph) : graph(graph) {}
+
+    /**
+     * @brief Reselects the primitive descriptors of the nodes, expects the nodes to be sorted topologically
+     */
+    void apply();
+
+    /**
+     * @brief Writes the selected layouts of the nodes along with the estimated reorder traffic before and after
+     * the optimization
+     */
+    void dump(std::ostream& stream) const;
+
+private:
+    bool isOptimizable(const MKLDNNNodePtr& node) const;
+    double getCost(const MKLDNNNodePtr& node, int pdIndex) const;
+    double getImplCost(const MKLDNNNodePtr& node, int pdIndex) const;
+    double getReordersCost() const;
+
+    MKLDNNGraph& graph;
+    double initialReordersCost = 0;
+    double finalReordersCost = 0;
+    size_t reselectedNodes = 0;
+};
+
+}  // namespace MKLDNNPlugin
@@ -94,6 +94,7 @@ void MKLDNNMemory::Create(const MemoryDesc &desc, const void *data, bool pads_ze
 
 void MKLDNNMemory::Create(MemoryDescPtr desc, const void* data, bool pads_zeroing) {
     pMemDesc = std::move(desc);
+    storage.reset();
     if (nullptr != data) {
         useExternalStorage = true;
     } else {
@@ -110,7 +111,8 @@ void MKLDNNMemory::Create(MemoryDescPtr desc, const void* data, bool pads_zeroin
         Create(dummyDesc.getDnnlDesc(), data, false);  // no pads zeroing
     }
     size_t newUpperBound = MKLDNNExtensionUtils::getMemSizeForDnnlDesc(prim->get_desc());
-    if (newUpperBound > memUpperBound) {
+    // the size of the own buffer is known exactly, while the external one is guaranteed to fit all the previous descriptors
+    if (!useExternalStorage || newUpperBound > memUpperBound) {
         memUpperBound = newUpperBound;
     }
 }
@@ -150,19 +152,23 @@ void MKLDNNMemory::redefineDesc(const MemoryDesc& desc, void *data) {
 void MKLDNNMemory::redefineDesc(MemoryDescPtr desc, void *data) {
     if (data != nullptr) {
         this->Create(std::move(desc), data, false);
-    } else if (useExternalStorage) {
-        if (!desc->hasDefinedMaxSize()) {
-            IE_THROW() << "Can not reset descriptor, memory upper bound is unknown.";
-        }
+        return;
+    }
 
-        size_t descMaxSize = desc->getMaxMemSize();
-        if (descMaxSize <= memUpperBound) {
-            this->Create(std::move(desc), prim->get_data_handle(), false);
-        } else {
-            this->Create(std::move(desc), nullptr, false);
-        }
+    if (useExternalStorage && !desc->hasDefinedMaxSize()) {
+        IE_THROW() << "Can not reset descriptor, memory upper bound is unknown.";
+    }
+
+    if (desc->hasDefinedMaxSize() && desc->getMaxMemSize() <= memUpperBound) {
+        // the current buffer is large enough, so the new descriptor is just a view on it
+        auto owner = useExternalStorage ? nullptr : (storage ? storage : prim);
+        const bool external = useExternalStorage;
+        this->Create(std::move(desc), prim->get_data_handle(), false);
+        useExternalStorage = external;
+        storage = std::move(owner);
     } else {
         this->Create(std::move(desc), nullptr, false);
+        reallocationsCount++;
     }
 }
 
@@ -91,6 +91,7 @@ public:
 
     // Redefines descriptor. The memory descriptor will be replaced with the new one.
     // Memory will not be reallocated if the new tensor size is less or equal the upper bound.
+    // The upper bound only grows, so the memory owned by the object settles at the largest size observed.
     // Caution!!! This action invalidates the previous data layout. The old data may become unreachable.
     void redefineDesc(const MemoryDesc& desc, void *data = nullptr);
     void redefineDesc(MemoryDescPtr desc, void *data = nullptr);
@@ -114,6 +115,13 @@ public:
         return useExternalStorage;
     }
 
+    /**
+     * @brief Returns how many times the descriptor redefinition could not reuse the current buffer and new memory was allocated
+     */
+    size_t getReallocationsCount() const {
+        return reallocationsCount;
+    }
+
 private:
     void Create(const mkldnn::memory::dims& dims, mkldnn::memory::data_type data_type, mkldnn::memory::format_tag format,
                 const void* data = nullptr);
@@ -123,9 +131,12 @@ private:
 private:
     MemoryDescPtr pMemDesc;
     std::shared_ptr<mkldnn::memory> prim;
+    // owns the buffer when prim is a view on the memory allocated for a larger descriptor
+    std::shared_ptr<mkldnn::memory> storage;
     mkldnn::engine eng;
     bool useExternalStorage = false;
     size_t memUpperBound = 0ul;
+    size_t reallocationsCount = 0ul;
 };
 
 using MKLDNNMemoryPtr = std::shared_ptr<MKLDNNMemory>;
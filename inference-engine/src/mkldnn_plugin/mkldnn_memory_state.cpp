@@ -14,4 +14,14 @@ void  MKLDNNVariableState::Reset() {
     std::memset(state->buffer(), 0, state->byteSize());
 }
 
+void MKLDNNVariableState::SetState(const Blob::Ptr& newState) {
+    if (!newState || newState->byteSize() != state->byteSize())
+        IE_THROW() << "Cannot set state " << name << ": the size of the blob doesn't match the size of the state";
+    const auto newStateData = newState->cbuffer().as<const void*>();
+    if (newStateData == nullptr)
+        IE_THROW() << "Cannot set state " << name << ": the blob has no allocated memory";
+    // the value is copied, so the blob of the user is never written by the inferences
+    cpu_memcpy(state->buffer(), newStateData, state->byteSize());
+}
+
 }  // namespace MKLDNNPlugin
@@ -11,19 +11,73 @@
 #include "memory_desc/cpu_memory_desc_utils.h"
 
 #include <string>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
+/**
+ * The two buffers of a variable state: the graph reads the current value from one of them and writes the new value
+ * to the other one, so making the new value current is only a swap. The buffers are also the allocator of the state
+ * blob, which is always locked to the current buffer, so the blob returned by GetState() stays the same object
+ * and always holds the current value.
+ */
+class MKLDNNVariableStateBuffers : public InferenceEngine::IAllocator {
+public:
+    explicit MKLDNNVariableStateBuffers(size_t size) : buffers{std::vector<uint8_t>(size), std::vector<uint8_t>(size)} {}
+
+    void* getReadPtr() {
+        return buffers[current].data();
+    }
+    void* getWritePtr() {
+        return buffers[1 - current].data();
+    }
+    void swap() {
+        current = 1 - current;
+    }
+
+    void* lock(void* handle, InferenceEngine::LockOp op = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return getReadPtr();
+    }
+    void unlock(void* handle) noexcept override {}
+    void* alloc(size_t size) noexcept override {
+        return size <= buffers[0].size() ? this : nullptr;
+    }
+    bool free(void* handle) noexcept override {
+        return true;
+    }
+
+private:
+    std::vector<uint8_t> buffers[2];
+    size_t current = 0;
+};
+
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
     MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
             InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
+        buffers = std::make_shared<MKLDNNVariableStateBuffers>(storage->GetSize());
+        cpu_memcpy(buffers->getReadPtr(), storage->GetData(), storage->GetSize());
+
+        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()), buffers);
         state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
     }
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+
+    void* getReadPtr() const {
+        return buffers->getReadPtr();
+    }
+    void* getWritePtr() const {
+        return buffers->getWritePtr();
+    }
+    // makes the value written by the last inference the current one
+    void commit() {
+        buffers->swap();
+    }
+
+private:
+    std::shared_ptr<MKLDNNVariableStateBuffers> buffers;
 };
 
-}  // namespace MKLDNNPlugin
\ No newline at end of file
+}  // namespace MKLDNNPlugin
@@ -6,6 +6,7 @@
 #include "dnnl_debug.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_itt.h"
+#include "utils/shape_inference/shape_inference.hpp"
 
 #include "caseless.hpp"
 #include <vector>
@@ -13,6 +14,7 @@
 #include <limits>
 #include <cstdint>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_conv_node.h>
@@ -519,6 +521,32 @@ void MKLDNNNode::executeDynamic(mkldnn::stream strm) {
     updateLastInputDims();
 }
 
+size_t MKLDNNNode::PrimitiveCacheKeyHasher::operator()(const PrimitiveCacheKey& key) const {
+    auto combine = [](size_t seed, size_t value) {
+        return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+    };
+    size_t seed = 0;
+    for (const auto& dims : key.inputDims) {
+        seed = combine(seed, dims.size());
+        for (const auto dim : dims)
+            seed = combine(seed, dim);
+    }
+    for (const auto param : key.params)
+        seed = combine(seed, param);
+    return seed;
+}
+
+std::shared_ptr<mkldnn::primitive> MKLDNNNode::getOrCreatePrimitive(const std::function<std::shared_ptr<mkldnn::primitive>()>& builder,
+                                                                    const std::vector<size_t>& params) {
+    PrimitiveCacheKey key;
+    key.inputDims.reserve(getParentEdges().size());
+    for (size_t i = 0; i < getParentEdges().size(); i++)
+        key.inputDims.push_back(getParentEdgesAtPort(i)[0]->getMemory().getStaticDims());
+    key.params = params;
+
+    return primitivesCache.getOrCreate(key, [&](const PrimitiveCacheKey&) { return builder(); });
+}
+
 void MKLDNNNode::redefineOutputMemory(const std::vector<VectorDims> &newOutputShapes) {
     if (newOutputShapes.size() != outputShapes.size()) {
         IE_THROW() << "Number shapes mismatch with real outputs number for node with name: " << getName();
@@ -558,6 +586,19 @@ void MKLDNNNode::redefineOutputMemory(const std::vector<VectorDims> &newOutputSh
     }
 }
 
+size_t MKLDNNNode::getOutputMemoryReallocationsCount() const {
+    size_t count = 0;
+    std::unordered_set<const MKLDNNMemory*> visited;
+    for (size_t i = 0; i < outputShapes.size(); i++) {
+        for (const auto& edge : getChildEdgesAtPort(i)) {
+            const auto& memory = edge->getMemory();
+            if (visited.insert(&memory).second)
+                count += memory.getReallocationsCount();
+        }
+    }
+    return count;
+}
+
 void MKLDNNNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
@@ -1353,7 +1394,42 @@ bool MKLDNNNode::needShapeInfer() const {
     return inputShapesModified();
 }
 
+namespace {
+void setStaticShape(ov::StaticShape& shape, const VectorDims& dims) {
+    shape.resize(dims.size());
+    std::copy(dims.begin(), dims.end(), shape.begin());
+}
+}  // namespace
+
+bool MKLDNNNode::shapeInferNative(std::vector<VectorDims>& outputDims) const {
+    if (!native_shape_inference(opToShapeInfer.get(), shapeInferInputs, shapeInferOutputs)) {
+        hasNativeShapeInfer = false;
+        return false;
+    }
+
+    outputDims.resize(shapeInferOutputs.size());
+    for (size_t i = 0; i < outputDims.size(); i++) {
+        const auto& shape = shapeInferOutputs[i];
+        outputDims[i].resize(shape.size());
+        std::transform(shape.begin(), shape.end(), outputDims[i].begin(), [](const ov::StaticDimension& dim) { return dim.get_length(); });
+    }
+    return true;
+}
+
 std::vector<VectorDims> MKLDNNNode::shapeInfer() const {
+    if (hasNativeShapeInfer) {
+        shapeInferInputs.resize(opToShapeInfer->get_input_size());
+        for (size_t i = 0; i < shapeInferInputs.size(); i++) {
+            setStaticShape(shapeInferInputs[i], getParentEdgesAtPort(i)[0]->getMemory().getStaticDims());
+        }
+
+        std::vector<VectorDims> newOutputShapes;
+        if (shapeInferNative(newOutputShapes)) {
+            IE_ASSERT(newOutputShapes.size() == outputShapes.size());
+            return newOutputShapes;
+        }
+    }
+
     std::vector<Shape> shapes;
     for (size_t i = 0; i < inputShapes.size(); i++) {
         shapes.push_back(getParentEdgesAtPort(i)[0]->getMemory().getDesc().getShape());
@@ -1372,6 +1448,19 @@ std::vector<VectorDims> MKLDNNNode::shapeInferGeneric(const std::vector<Shape>&
             " required for node with name: " << getName();
     }
 
+    const bool allShapesStatic = std::all_of(shapes.begin(), shapes.begin() + opToShapeInfer->get_input_size(),
+                                             [](const Shape& shape) { return shape.isStatic(); });
+    if (hasNativeShapeInfer && allShapesStatic) {
+        shapeInferInputs.resize(opToShapeInfer->get_input_size());
+        for (size_t i = 0; i < shapeInferInputs.size(); i++) {
+            setStaticShape(shapeInferInputs[i], shapes[i].getStaticDims());
+        }
+
+        std::vector<VectorDims> newOutputShapes;
+        if (shapeInferNative(newOutputShapes))
+            return newOutputShapes;
+    }
+
     for (size_t i = 0; i < opToShapeInfer->get_input_size(); i++) {
         if (!dynamic_cast<ngraph::opset1::Constant *>(opToShapeInfer->get_input_node_ptr(i))) {
             opToShapeInfer->get_input_tensor(i).set_partial_shape(shapes[i].toPartialShape());
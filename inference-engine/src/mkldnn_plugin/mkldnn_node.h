@@ -29,6 +29,8 @@
 #include "cpu_types.h"
 #include "cpu_shape.h"
 #include "memory_desc/cpu_memory_desc.h"
+#include "utils/lru_cache.h"
+#include "utils/shape_inference/static_shape.hpp"
 
 namespace MKLDNNPlugin {
 
@@ -354,6 +356,61 @@ public:
     void executeDynamic(mkldnn::stream strm);
     void redefineOutputMemory(const std::vector<VectorDims> &newShapes);
 
+    /**
+     * @brief Key of the primitives cache: the input dims and the node specific runtime parameters the primitive depends on
+     */
+    struct PrimitiveCacheKey {
+        std::vector<VectorDims> inputDims;
+        std::vector<size_t> params;
+
+        bool operator==(const PrimitiveCacheKey& rhs) const {
+            return inputDims == rhs.inputDims && params == rhs.params;
+        }
+    };
+    struct PrimitiveCacheKeyHasher {
+        size_t operator()(const PrimitiveCacheKey& key) const;
+    };
+    using PrimitivesCache = LruCache<PrimitiveCacheKey, std::shared_ptr<mkldnn::primitive>, PrimitiveCacheKeyHasher>;
+
+    /**
+     * @brief Sets the number of primitives created for different input shapes the node keeps to avoid their recreation
+     * when the shapes are changed back. Zero value turns the cache off.
+     */
+    void setPrimitivesCacheCapacity(size_t capacity) {
+        primitivesCache.setCapacity(capacity);
+    }
+    const PrimitivesCache::Statistics& getPrimitivesCacheStatistics() const {
+        return primitivesCache.statistics();
+    }
+
+    /**
+     * @brief Returns how many times the output memory of the node was reallocated because the new shape did not fit
+     * the buffer allocated before
+     */
+    size_t getOutputMemoryReallocationsCount() const;
+
+    /**
+     * @brief Returns how many constant outputs of the node were restored from the data precomputed by the exported
+     * network instead of being computed
+     */
+    size_t getPrecomputedOutputsCount() const {
+        return precomputedOutputsCount;
+    }
+    void addPrecomputedOutput() {
+        precomputedOutputsCount++;
+    }
+
+    /**
+     * @brief Returns how many constant outputs of the node were restored from the persistent weights cache instead of
+     * being computed
+     */
+    size_t getPersistentCacheOutputsCount() const {
+        return persistentCacheOutputsCount;
+    }
+    void addPersistentCacheOutput() {
+        persistentCacheOutputsCount++;
+    }
+
     virtual void initSupportedPrimitiveDescriptors();
 
     /**
@@ -435,6 +492,20 @@ public:
         return execIndex;
     }
 
+    /**
+     * @brief Returns the level of the node in the graph when the independent branches are executed concurrently, -1 otherwise
+     */
+    int getExecLevel() const {
+        return execLevel;
+    }
+
+    /**
+     * @brief Returns how many times the node was executed concurrently with the other nodes of its level
+     */
+    size_t getConcurrentExecutionsCount() const {
+        return concurrentExecutionsCount;
+    }
+
     std::string getTypeStr() const {
         return typeStr;
     }
@@ -737,10 +808,31 @@ protected:
         IE_THROW(NotImplemented) << "[DS] prapareParams not implemented for node with type " << NameFromType(getType());
     }
 
+    /**
+     * @brief Returns the primitive cached for the current input dims and the runtime parameters or creates a new one using the builder.
+     * Intended to be used in prepareParams() of dynamic nodes, so the oneDNN primitives are not recreated each time the shapes are changed.
+     * @param builder creates the primitive if there is no cached one
+     * @param params node specific runtime parameters the primitive depends on besides the input dims
+     */
+    std::shared_ptr<mkldnn::primitive> getOrCreatePrimitive(const std::function<std::shared_ptr<mkldnn::primitive>()>& builder,
+                                                            const std::vector<size_t>& params = {});
+
     std::vector<VectorDims> lastInputDims = {};
+    PrimitivesCache primitivesCache;
     std::shared_ptr<ngraph::Node> opToShapeInfer;
 
 private:
+    /**
+     * @brief Infers the output dims for the input dims stored in shapeInferInputs using static shape inference implemented
+     * for the operation natively. Returns false if there is no such implementation, so the generic one should be used.
+     */
+    bool shapeInferNative(std::vector<VectorDims>& outputDims) const;
+
+    // buffers are reused between the calls to avoid allocations on each inference
+    mutable std::vector<ov::StaticShape> shapeInferInputs;
+    mutable std::vector<ov::StaticShape> shapeInferOutputs;
+    mutable bool hasNativeShapeInfer = true;
+
     std::vector<MKLDNNEdgeWeakPtr> parentEdges;
     std::vector<MKLDNNEdgeWeakPtr> childEdges;
 
@@ -755,6 +847,12 @@ private:
     std::string typeStr;
     Type type;
     int execIndex = -1;
+    // length of the longest path from the graph inputs, the nodes of one level don't depend on each other
+    int execLevel = -1;
+    // is only changed by the thread executing the node
+    size_t concurrentExecutionsCount = 0;
+    size_t precomputedOutputsCount = 0;
+    size_t persistentCacheOutputsCount = 0;
 
     std::string typeToStr(Type type);
 
@@ -12,6 +12,7 @@
 
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
+#include <functional>
 #include <ie_plugin_config.hpp>
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <ie_icore.hpp>
@@ -84,6 +85,7 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset4.hpp>
 #include <ngraph/opsets/opset6.hpp>
+#include <ngraph/opsets/opset8.hpp>
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/pass/manager.hpp>
 #include <ngraph/graph_util.hpp>
@@ -109,6 +111,7 @@
 #include "nodes/mkldnn_normalize_node.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
 #include "ngraph_transformations/move_eltwise_up_data_movement.hpp"
+#include <snippets/pass/collapse_subgraph.hpp>
 #include "transformations/smart_reshape/smart_reshape.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
@@ -170,6 +173,7 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
 
     manager.register_pass<ngraph::pass::CommonOptimizations>();
     manager.register_pass<ngraph::pass::WrapInterpolateIntoTransposes>();
+    manager.register_pass<ngraph::pass::TransposeEltwise>();
     manager.register_pass<ngraph::pass::TransposeSinking>();
     manager.register_pass<ngraph::pass::ConvertRNNSequenceToTensorIterator>();
     manager.register_pass<ngraph::pass::ConvertGRUSequenceToTensorIterator>();
@@ -238,31 +242,36 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     };
 
     // Sequences supported by the plugin shouldn't be converted to TensorIterator.
-    // sequence_length input is not supported in all Sequences, so if is_seq_len_provided() == true, we
-    // should always convert to TensorIterator.
+    // The batch and the sequence length may be dynamic. The plugin handles the sequence_length input shorter than
+    // the sequence only for the forward direction, so if is_seq_len_provided() == true for other directions, we
+    // should always convert to TensorIterator. The dynamic bidirectional sequences are converted to TensorIterator too.
     // RNN/GRU/LSTM Sequences are supported with clip == 0, and with default activations.
     auto isSequencePrimitiveSupported = [](const_node_ptr &node) -> bool {
-        const auto& data = node->input(0);
-        const auto& data_pshape = data.get_partial_shape();
-        if (data_pshape.rank().is_static() && data_pshape.rank().get_length() > 1 && !data_pshape[1].is_static())
+        const auto& data_pshape = node->get_input_partial_shape(0);
+        if (data_pshape.rank().is_dynamic() || data_pshape.rank().get_length() != 3 || data_pshape[2].is_dynamic())
             return false;
-        auto max_seq_len = data.get_shape().at(1);
+        auto isSeqLenSupported = [&node, &data_pshape](ngraph::op::RecurrentSequenceDirection direction,
+                                                       const std::shared_ptr<ngraph::Node>& seq_len_node) {
+            if (direction == ngraph::op::RecurrentSequenceDirection::FORWARD)
+                return true;
+            if (direction == ngraph::op::RecurrentSequenceDirection::BIDIRECTIONAL && node->is_dynamic())
+                return false;
+            return data_pshape[1].is_static() &&
+                   !ngraph::op::util::is_seq_len_provided(seq_len_node, data_pshape[1].get_length());
+        };
         if (const auto &rnn_seq = std::dynamic_pointer_cast<const ngraph::opset6::RNNSequence>(node)) {
             return rnn_seq->get_clip() == 0.0f &&
-                   !ngraph::op::util::is_seq_len_provided(rnn_seq->get_input_node_shared_ptr(2),
-                                                          max_seq_len);
+                   isSeqLenSupported(rnn_seq->get_direction(), rnn_seq->get_input_node_shared_ptr(2));
         } else if (const auto &gru_seq = std::dynamic_pointer_cast<const ngraph::opset6::GRUSequence>(
                 node)) {
             return gru_seq->get_clip() == 0.0f &&
                    gru_seq->get_activations() == std::vector<std::string>{"sigmoid", "tanh"} &&
-                   !ngraph::op::util::is_seq_len_provided(gru_seq->get_input_node_shared_ptr(2),
-                                                          max_seq_len);
+                   isSeqLenSupported(gru_seq->get_direction(), gru_seq->get_input_node_shared_ptr(2));
         } else if (const auto &lstm_seq = std::dynamic_pointer_cast<const ngraph::opset6::LSTMSequence>(
                 node)) {
             return lstm_seq->get_clip() == 0.0f &&
                    lstm_seq->get_activations() == std::vector<std::string>{"sigmoid", "tanh", "tanh"} &&
-                   !ngraph::op::util::is_seq_len_provided(lstm_seq->get_input_node_shared_ptr(3),
-                                                          max_seq_len);
+                   isSeqLenSupported(lstm_seq->get_direction(), lstm_seq->get_input_node_shared_ptr(3));
         }
         return false;
     };
@@ -489,6 +498,47 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     postLPTPassManager.run_passes(nGraphFunc);
 }
 
+using SnippetsCallback = std::function<bool(const std::shared_ptr<const ngraph::Node>&)>;
+
+// eltwise chains which are fused into the parent node as post ops are left to the graph level fusing
+static bool isFusedIntoParent(const std::shared_ptr<const ngraph::Node>& node) {
+    const auto isColorConvert = [](const std::shared_ptr<const ngraph::Node>& node) {
+        return ngraph::is_type<ngraph::opset8::NV12toRGB>(node) || ngraph::is_type<ngraph::opset8::NV12toBGR>(node) ||
+               ngraph::is_type<ngraph::opset8::I420toRGB>(node) || ngraph::is_type<ngraph::opset8::I420toBGR>(node);
+    };
+    for (const auto& input : node->input_values()) {
+        const auto parent = input.get_node_shared_ptr();
+        // the mean/scale normalization after the color conversion is fused together with the preceding Convert
+        const bool isConvertOfColorConvert = ngraph::is_type<ngraph::opset1::Convert>(parent) &&
+                                             isColorConvert(parent->get_input_node_shared_ptr(0));
+        const bool isFusingParent = ngraph::is_type<ngraph::opset1::Convolution>(parent) ||
+                                    ngraph::is_type<ngraph::opset1::GroupConvolution>(parent) ||
+                                    ngraph::is_type<ngraph::opset1::ConvolutionBackpropData>(parent) ||
+                                    ngraph::is_type<ngraph::opset1::GroupConvolutionBackpropData>(parent) ||
+                                    ngraph::is_type<ngraph::opset1::MatMul>(parent) ||
+                                    isColorConvert(parent) || isConvertOfColorConvert;
+        if (isFusingParent && parent->get_output_target_inputs(0).size() == 1)
+            return true;
+    }
+    return false;
+}
+
+// skipTokenization is the callback of the tokenization passes, the ops it returns true for are left out of the snippets
+static void Snippets(const std::shared_ptr<ngraph::Function>& nGraphFunc, const Config& conf,
+                     const SnippetsCallback& skipTokenization) {
+    // snippets are generated for fp32 only, so tokenization is skipped when the graph is going to be executed in bf16
+    if (conf.snippetsMode == Config::SnippetsMode::Disable || conf.enforceBF16 || !with_cpu_x86_avx2())
+        return;
+
+    ngraph::pass::Manager snippetsManager;
+    snippetsManager.register_pass<ngraph::snippets::pass::TokenizeSnippets>();
+    if (skipTokenization) {
+        snippetsManager.get_pass_config()->set_callback<ngraph::snippets::pass::StartSubgraph,
+                                                        ngraph::snippets::pass::AttachToSubgraph>(skipTokenization);
+    }
+    snippetsManager.run_passes(nGraphFunc);
+}
+
 static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT) {
     auto nGraphFunc = clonedNetwork.getFunction();
     TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT);
@@ -599,7 +649,6 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
            }
         }
     }
-    ConvertToCPUSpecificOpset(nGraphFunc);
 
     // update the props after the perf mode translated to configs
     // TODO: Clarify the behavior of SetConfig method. Skip eng_config or not?
@@ -609,6 +658,9 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
+    Snippets(nGraphFunc, conf, conf.snippetsMode == Config::SnippetsMode::IgnoreCallback ? SnippetsCallback{} : isFusedIntoParent);
+    ConvertToCPUSpecificOpset(nGraphFunc);
+
     return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
 }
 
@@ -811,6 +863,10 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
     CNNNetwork cnnnetwork;
     deserializer >> cnnnetwork;
 
+    PrecomputedConstants::Ptr precomputedConstants;
+    PrecomputedConstantsDeserializer constantsDeserializer(networkModel);
+    constantsDeserializer >> precomputedConstants;
+
     Config conf = engConfig;
     conf.readProperties(config);
 
@@ -818,7 +874,18 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
     }
 
-    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(cnnnetwork, conf, extensionManager, weightsSharing);
+    // The network is exported with the snippets inlined, see MKLDNNExecNetwork::Export. It is already in the CPU
+    // specific opset, so the tokenization callback would see other ops than on the compilation (e.g. FullyConnected
+    // instead of MatMul). So the ops of the exported snippets are tokenized again, and nothing else.
+    SnippetsCallback skipTokenization = isFusedIntoParent;
+    if (const auto snippetsOps = deserializer.getSnippetsOps()) {
+        skipTokenization = [snippetsOps](const std::shared_ptr<const ngraph::Node>& node) {
+            return snippetsOps->count(node->get_friendly_name()) == 0;
+        };
+    }
+    Snippets(cnnnetwork.getFunction(), conf, skipTokenization);
+
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(cnnnetwork, conf, extensionManager, weightsSharing, precomputedConstants);
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
@@ -40,6 +40,35 @@ namespace {
         IE_THROW(NetworkNotRead) << "Unknown layout with name '" << name << "'";
     }
 
+    struct PrecomputedConstantsHeader {
+        static constexpr uint64_t magicValue = 0x5354534e4f435043;   // "CPCONSTS"
+        static constexpr uint32_t versionValue = 2;
+
+        uint64_t magic = magicValue;
+        uint32_t version = versionValue;
+        uint32_t isa = 0;
+        uint64_t count = 0;
+        uint64_t size = 0;      // size of the data following the header
+    };
+
+    uint32_t currentIsa() {
+        return static_cast<uint32_t>(dnnl::get_effective_cpu_isa());
+    }
+
+    void writeString(std::ostream & stream, const std::string & str) {
+        const uint64_t size = str.size();
+        stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        stream.write(str.data(), size);
+    }
+
+    std::string readString(std::istream & stream) {
+        uint64_t size = 0;
+        stream.read(reinterpret_cast<char*>(&size), sizeof(size));
+        std::string str(size, '\0');
+        stream.read(&str[0], size);
+        return str;
+    }
+
     template<typename T>
     void setPrecisionsAndLayouts(
         pugi::xml_object_range<pugi::xml_named_node_iterator> && nodes,
@@ -66,9 +95,11 @@ namespace {
     }
 };  // namespace
 
-CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager)
+CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager,
+                                           std::unordered_set<std::string> snippetsOps)
     : _ostream(ostream)
-    , _extensionManager(extensionManager) {
+    , _extensionManager(extensionManager)
+    , _snippetsOps(std::move(snippetsOps)) {
 }
 
 void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
@@ -114,6 +145,12 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
                     .set_value(to_string(out.second->getLayout()).c_str());
         }
 
+        // the element is written even without the snippets, so the import can tell there is nothing to tokenize
+        pugi::xml_node snippets = root.append_child("snippets");
+        for (const auto & op : _snippetsOps) {
+            snippets.append_child("op").append_attribute("name").set_value(op.c_str());
+        }
+
         xml_doc.save(stream);
     };
 
@@ -171,6 +208,110 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
 
     setPrecisionsAndLayouts(inputs.children("in"), network.getInputsInfo());
     setPrecisionsAndLayouts(outputs.children("out"), network.getOutputsInfo());
+
+    _snippetsOps = nullptr;
+    pugi::xml_node snippets = root.child("snippets");
+    if (snippets) {
+        auto snippetsOps = std::make_shared<std::unordered_set<std::string>>();
+        for (auto op : snippets.children("op")) {
+            snippetsOps->insert(op.attribute("name").value());
+        }
+        _snippetsOps = snippetsOps;
+    }
+}
+
+PrecomputedConstantsSerializer::PrecomputedConstantsSerializer(std::ostream & ostream)
+    : _ostream(ostream) {
+}
+
+void PrecomputedConstantsSerializer::operator << (const MKLDNNGraph & graph) {
+    const auto edges = graph.GetConstantOutputEdges();
+
+    PrecomputedConstantsHeader hdr = {};
+    hdr.isa = currentIsa();
+    hdr.count = edges.size();
+
+    const auto header_offset = _ostream.tellp();
+    _ostream.write(reinterpret_cast<const char*>(&hdr), sizeof hdr);
+
+    const auto data_offset = _ostream.tellp();
+    for (const auto & edge : edges) {
+        const auto & memory = edge->getMemory();
+        writeString(_ostream, edge->name());
+        writeString(_ostream, PrecomputedConstants::describe(memory));
+        const uint64_t size = memory.GetSize();
+        _ostream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        _ostream.write(reinterpret_cast<const char*>(memory.GetData()), size);
+    }
+
+    const auto & selectedDescriptors = graph.GetSelectedDescriptors();
+    const uint64_t selectedCount = selectedDescriptors.size();
+    _ostream.write(reinterpret_cast<const char*>(&selectedCount), sizeof(selectedCount));
+    for (const auto & selected : selectedDescriptors) {
+        writeString(_ostream, selected.first);
+        const int32_t index = selected.second.index;
+        const uint64_t implType = static_cast<uint64_t>(selected.second.implType);
+        _ostream.write(reinterpret_cast<const char*>(&index), sizeof(index));
+        _ostream.write(reinterpret_cast<const char*>(&implType), sizeof(implType));
+    }
+    const auto end_offset = _ostream.tellp();
+
+    hdr.size = static_cast<uint64_t>(end_offset - data_offset);
+    _ostream.seekp(header_offset);
+    _ostream.write(reinterpret_cast<const char*>(&hdr), sizeof hdr);
+    _ostream.seekp(end_offset);
+}
+
+PrecomputedConstantsDeserializer::PrecomputedConstantsDeserializer(std::istream & istream)
+    : _istream(istream) {
+}
+
+void PrecomputedConstantsDeserializer::operator >> (PrecomputedConstants::Ptr & constants) {
+    constants = nullptr;
+
+    const auto header_offset = _istream.tellg();
+    PrecomputedConstantsHeader hdr = {};
+    _istream.read(reinterpret_cast<char*>(&hdr), sizeof hdr);
+    if (!_istream || hdr.magic != PrecomputedConstantsHeader::magicValue) {
+        // no precomputed data, the stream is left as is
+        _istream.clear();
+        _istream.seekg(header_offset);
+        return;
+    }
+
+    const auto data_offset = _istream.tellg();
+    if (hdr.version != PrecomputedConstantsHeader::versionValue || hdr.isa != currentIsa()) {
+        _istream.seekg(data_offset + static_cast<std::streamoff>(hdr.size));
+        return;
+    }
+
+    auto result = std::make_shared<PrecomputedConstants>();
+    for (uint64_t i = 0; i < hdr.count; i++) {
+        const auto name = readString(_istream);
+        PrecomputedConstants::Data data;
+        data.desc = readString(_istream);
+        uint64_t size = 0;
+        _istream.read(reinterpret_cast<char*>(&size), sizeof(size));
+        data.data.resize(size);
+        _istream.read(reinterpret_cast<char*>(data.data.data()), size);
+        result->edges.emplace(name, std::move(data));
+    }
+
+    uint64_t selectedCount = 0;
+    _istream.read(reinterpret_cast<char*>(&selectedCount), sizeof(selectedCount));
+    for (uint64_t i = 0; i < selectedCount && _istream; i++) {
+        const auto name = readString(_istream);
+        int32_t index = -1;
+        uint64_t implType = 0;
+        _istream.read(reinterpret_cast<char*>(&index), sizeof(index));
+        _istream.read(reinterpret_cast<char*>(&implType), sizeof(implType));
+        result->selectedDescriptors[name] = {index, static_cast<impl_desc_type>(implType)};
+    }
+
+    if (!_istream) {
+        IE_THROW(NetworkNotRead) << "The precomputed constants information is invalid.";
+    }
+    constants = result;
 }
 
 }  // namespace MKLDNNPlugin
@@ -3,21 +3,31 @@
 //
 #pragma once
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_graph.h"
 
 #include <iostream>
 #include <functional>
+#include <memory>
+#include <string>
+#include <unordered_set>
 #include <cpp/ie_cnn_network.h>
 
 namespace MKLDNNPlugin {
 
+/**
+ * Writes the network to the stream. The snippets are not a part of any opset, so the serialized network is expected to
+ * have their bodies inlined, while the names of the inlined ops are stored along with the network.
+ */
 class CNNNetworkSerializer {
 public:
-    CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager);
+    CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager,
+                         std::unordered_set<std::string> snippetsOps = {});
     void operator << (const InferenceEngine::CNNNetwork & network);
 
 private:
     std::ostream & _ostream;
     MKLDNNExtensionManager::Ptr _extensionManager;
+    std::unordered_set<std::string> _snippetsOps;
 };
 
 class CNNNetworkDeserializer {
@@ -29,9 +39,48 @@ public:
     CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
     void operator >> (InferenceEngine::CNNNetwork & network);
 
+    /**
+     * @brief Returns the names of the ops which formed the snippets of the exported network, so exactly the same ops
+     * are tokenized again. Is nullptr if the stream doesn't contain the information (e.g. the blob was exported by an
+     * older version)
+     */
+    const std::shared_ptr<const std::unordered_set<std::string>>& getSnippetsOps() const {
+        return _snippetsOps;
+    }
+
 private:
     std::istream & _istream;
     cnn_network_builder _cnn_network_builder;
+    std::shared_ptr<const std::unordered_set<std::string>> _snippetsOps;
+};
+
+/**
+ * Writes results of the graph constant path and the primitive descriptors selected for the nodes
+ * (see PrecomputedConstants) to the stream.
+ * Is expected to be used right after CNNNetworkSerializer, so the data follows the serialized network.
+ */
+class PrecomputedConstantsSerializer {
+public:
+    explicit PrecomputedConstantsSerializer(std::ostream & ostream);
+    void operator << (const MKLDNNGraph & graph);
+
+private:
+    std::ostream & _ostream;
+};
+
+/**
+ * Reads results of the graph constant path and the selected primitive descriptors written by
+ * PrecomputedConstantsSerializer.
+ * Produces nullptr if the stream doesn't contain the data (e.g. the blob was exported by an older version)
+ * or the data was produced on a platform with another ISA, so the layouts selected for the graph may differ.
+ */
+class PrecomputedConstantsDeserializer {
+public:
+    explicit PrecomputedConstantsDeserializer(std::istream & istream);
+    void operator >> (PrecomputedConstants::Ptr & constants);
+
+private:
+    std::istream & _istream;
 };
 
 // const std::string& model, const Blob::CPtr& weights
@@ -5,12 +5,43 @@
 #include "mkldnn_weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <openvino/util/file_util.hpp>
+#include <openvino/util/mmap_object.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
 #include <memory>
+#include <sstream>
+#include <thread>
 
 namespace MKLDNNPlugin {
 
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
+namespace {
+
+// the header precedes the data of every entry, so the truncated, corrupted or foreign files are not taken for the data
+struct PersistentWeightsHeader {
+    static constexpr uint64_t magicValue = 0x5354484757555043;   // "CPUWGHTS"
+    static constexpr uint32_t versionValue = 1;
+
+    uint64_t magic = magicValue;
+    uint32_t version = versionValue;
+    uint32_t reserved = 0;
+    uint64_t key = 0;
+    uint64_t size = 0;
+    uint64_t checksum = 0;   // of the data following the header
+};
+
+constexpr uint64_t PersistentWeightsHeader::magicValue;
+constexpr uint32_t PersistentWeightsHeader::versionValue;
+
+}  // namespace
+
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
         std::unique_lock<std::mutex> && lock,
         const MKLDNNMemoryInfo::Ptr & memory,
@@ -70,6 +101,77 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+MKLDNNPersistentWeightsCache::MKLDNNPersistentWeightsCache(const std::string& dir) : _dir(dir) {
+    ov::util::create_directory_recursive(_dir);
+}
+
+std::string MKLDNNPersistentWeightsCache::path(uint64_t key) const {
+    std::stringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << key << ".cpuw";
+    return ov::util::path_join({_dir, name.str()});
+}
+
+bool MKLDNNPersistentWeightsCache::read(uint64_t key, size_t size, const std::function<void(const void*)>& reader) const {
+    const auto file = path(key);
+    if (!ov::util::file_exists(file))
+        return false;
+
+    std::shared_ptr<ov::util::MappedMemory> mapped;
+    try {
+        mapped = ov::util::load_mmap_object(file);
+    } catch (const std::exception&) {
+        // the entry may be removed by another process in the meantime, it is just a cache miss then
+        return false;
+    }
+    if (mapped->size() != sizeof(PersistentWeightsHeader) + size)
+        return false;
+
+    PersistentWeightsHeader hdr;
+    std::memcpy(&hdr, mapped->data(), sizeof(hdr));
+    const auto data = reinterpret_cast<const unsigned char*>(mapped->data()) + sizeof(hdr);
+    if (hdr.magic != PersistentWeightsHeader::magicValue || hdr.version != PersistentWeightsHeader::versionValue ||
+        hdr.key != key || hdr.size != size || hdr.checksum != MKLDNNWeightsSharing::GetHashFunc().hash(data, size))
+        return false;
+
+    reader(data);
+    return true;
+}
+
+void MKLDNNPersistentWeightsCache::write(uint64_t key, const void* data, size_t size) const {
+    static std::atomic<uint64_t> counter{0};
+
+    const auto file = path(key);
+    if (ov::util::file_exists(file))
+        return;
+
+    // the data is written to the unique temporary file first, so the readers never see a partially written entry
+    std::stringstream suffix;
+    suffix << "." << std::hash<std::thread::id>{}(std::this_thread::get_id())
+           << "." << std::chrono::steady_clock::now().time_since_epoch().count()
+           << "." << counter++ << ".tmp";
+    const auto tmpFile = file + suffix.str();
+    {
+        std::ofstream stream(tmpFile, std::ios::binary);
+        if (!stream)
+            return;
+        PersistentWeightsHeader hdr;
+        hdr.key = key;
+        hdr.size = size;
+        hdr.checksum = MKLDNNWeightsSharing::GetHashFunc().hash(reinterpret_cast<const unsigned char*>(data), size);
+        stream.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+        stream.write(reinterpret_cast<const char*>(data), size);
+        if (!stream) {
+            stream.close();
+            std::remove(tmpFile.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmpFile.c_str(), file.c_str()) != 0) {
+        // the entry has been stored by another writer
+        std::remove(tmpFile.c_str());
+    }
+}
+
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
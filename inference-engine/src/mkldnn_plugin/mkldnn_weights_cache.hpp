@@ -5,6 +5,7 @@
 #pragma once
 
 #include <mkldnn_memory.h>
+#include <openvino/util/xxhash.hpp>
 
 #include <unordered_map>
 #include <functional>
@@ -24,26 +25,9 @@ namespace MKLDNNPlugin {
 
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
     uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
+        return ov::util::xxhash64(data, size);
     }
-
-protected:
-    static constexpr int kTableSize = 256;
-    uint64_t table[kTableSize];
 };
 
 /**
@@ -101,6 +85,37 @@ protected:
     static const SimpleDataHash simpleCRC;
 };
 
+/**
+ * On-disk store of the data produced by the constant path of the graph (e.g. weights reordered to the blocked layouts).
+ * Every entry is a separate file named after the key, which is expected to be derived from the content the data is
+ * computed of, so the entries are reused by different networks, processes and restarts.
+ *
+ * Is a thread safe
+ */
+class MKLDNNPersistentWeightsCache {
+public:
+    typedef std::shared_ptr<MKLDNNPersistentWeightsCache> Ptr;
+
+    explicit MKLDNNPersistentWeightsCache(const std::string& dir);
+
+    /**
+     * Maps the data of the entry to the memory and calls the reader for it.
+     * @return false if there is no entry with the key, its size differs from the expected one or the data doesn't match
+     * the checksum stored with it
+     */
+    bool read(uint64_t key, size_t size, const std::function<void(const void*)>& reader) const;
+
+    /**
+     * Stores the entry. Concurrent writers of the same key are allowed, since the file appears atomically.
+     */
+    void write(uint64_t key, const void* data, size_t size) const;
+
+private:
+    std::string path(uint64_t key) const;
+
+    std::string _dir;
+};
+
 /**
  * Collection of memory caching store per NUMA node(former socket)
  *
@@ -23,6 +23,9 @@ namespace {
         // of the attribute to plug-ins.
         // todo: specify seqAxis attribute for Sequence ops.
         int64_t seqAxis = 1; // default
+        // the Reshapes replacing the Transposes are created for the static shapes only
+        if (sequenceOp->is_dynamic())
+            return seqAxis;
         const auto& target_inputs = sequenceOp->output(0).get_target_inputs();
         if (target_inputs.size() == 1) {
             const auto& transpose_before = std::dynamic_pointer_cast<ngraph::op::v1::Transpose>(sequenceOp->input_value(0).get_node_shared_ptr());
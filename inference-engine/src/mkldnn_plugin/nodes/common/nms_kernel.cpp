@@ -0,0 +1,387 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_kernel.h"
+
+#include <ie_parallel.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include <mkldnn.hpp>  // TODO: just to replace mkldnn->dnnl via macros
+
+#include <cassert>
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_args_nms_iou, field)
+
+namespace {
+
+// the suppression of a large range is split between the threads
+constexpr size_t minParallelBlocks = 64;
+
+}  // namespace
+
+struct jit_args_nms_iou {
+    const float* x1;
+    const float* y1;
+    const float* x2;
+    const float* y2;
+    const float* area;
+    void* dst;
+    size_t work_amount;
+    float ref_x1;
+    float ref_y1;
+    float ref_x2;
+    float ref_y2;
+    float ref_area;
+    float offset;
+    float threshold;
+};
+
+struct jit_nms_iou_config_params {
+    NmsIouType type;
+    // writes the bits of IoU >= threshold per block of 64 boxes instead of the IoU values per vector
+    bool suppress;
+};
+
+namespace MKLDNNPlugin {
+
+struct jit_uni_nms_iou_kernel {
+    void (*ker_)(const jit_args_nms_iou *);
+
+    void operator()(const jit_args_nms_iou *args) { assert(ker_); ker_(args); }
+
+    jit_uni_nms_iou_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_nms_iou_kernel() {}
+
+    virtual void create_ker() = 0;
+};
+
+}  // namespace MKLDNNPlugin
+
+template <cpu_isa_t isa>
+struct jit_uni_nms_iou_kernel_f32 : public jit_uni_nms_iou_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_nms_iou_kernel_f32)
+
+    explicit jit_uni_nms_iou_kernel_f32(jit_nms_iou_config_params jcp) : jit_uni_nms_iou_kernel(), jit_generator(), jcp_(jcp) {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_x1, ptr[reg_params + GET_OFF(x1)]);
+        mov(reg_y1, ptr[reg_params + GET_OFF(y1)]);
+        mov(reg_x2, ptr[reg_params + GET_OFF(x2)]);
+        mov(reg_y2, ptr[reg_params + GET_OFF(y2)]);
+        mov(reg_area, ptr[reg_params + GET_OFF(area)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        uni_vbroadcastss(vmm_ref_x1, ptr[reg_params + GET_OFF(ref_x1)]);
+        uni_vbroadcastss(vmm_ref_y1, ptr[reg_params + GET_OFF(ref_y1)]);
+        uni_vbroadcastss(vmm_ref_x2, ptr[reg_params + GET_OFF(ref_x2)]);
+        uni_vbroadcastss(vmm_ref_y2, ptr[reg_params + GET_OFF(ref_y2)]);
+        uni_vbroadcastss(vmm_ref_area, ptr[reg_params + GET_OFF(ref_area)]);
+        uni_vbroadcastss(vmm_offset, ptr[reg_params + GET_OFF(offset)]);
+        uni_vbroadcastss(vmm_threshold, ptr[reg_params + GET_OFF(threshold)]);
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        const size_t step = jcp_.suppress ? NmsBoxesSoA::block : simd_w;
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+        L(loop_label); {
+            cmp(reg_work_amount, 0);
+            jle(loop_end_label, T_NEAR);
+
+            if (jcp_.suppress) {
+                xor_(reg_bits, reg_bits);
+                for (size_t v = 0; v < NmsBoxesSoA::block / simd_w; v++) {
+                    compute_iou(v * vlen);
+                    // threshold <= iou
+                    cmp_ps(vmm_mask, k_mask, vmm_threshold, vmm_x2, _cmp_le_os);
+                    store_mask_bits(reg_tmp);
+                    if (v > 0)
+                        shl(reg_tmp, static_cast<int>(v * simd_w));
+                    or_(reg_bits, reg_tmp);
+                }
+                or_(ptr[reg_dst], reg_bits);
+                add(reg_dst, sizeof(uint64_t));
+            } else {
+                compute_iou(0);
+                uni_vmovups(ptr[reg_dst], vmm_x2);
+                add(reg_dst, vlen);
+            }
+
+            add(reg_x1, step * sizeof(float));
+            add(reg_y1, step * sizeof(float));
+            add(reg_x2, step * sizeof(float));
+            add(reg_y2, step * sizeof(float));
+            add(reg_area, step * sizeof(float));
+            sub(reg_work_amount, 1);
+
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+    const size_t simd_w = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_x1 = r8;
+    Xbyak::Reg64 reg_y1 = r9;
+    Xbyak::Reg64 reg_x2 = r10;
+    Xbyak::Reg64 reg_y2 = r11;
+    Xbyak::Reg64 reg_area = r12;
+    Xbyak::Reg64 reg_dst = r13;
+    Xbyak::Reg64 reg_work_amount = r14;
+    Xbyak::Reg64 reg_bits = r15;
+    Xbyak::Reg64 reg_tmp = rax;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_mask = Vmm(0);
+    Vmm vmm_tmp = Vmm(1);
+    Vmm vmm_x1 = Vmm(2);
+    Vmm vmm_y1 = Vmm(3);
+    Vmm vmm_x2 = Vmm(4);
+    Vmm vmm_y2 = Vmm(5);
+    Vmm vmm_area = Vmm(6);
+    Vmm vmm_zero = Vmm(7);
+    Vmm vmm_ref_x1 = Vmm(8);
+    Vmm vmm_ref_y1 = Vmm(9);
+    Vmm vmm_ref_x2 = Vmm(10);
+    Vmm vmm_ref_y2 = Vmm(11);
+    Vmm vmm_ref_area = Vmm(12);
+    Vmm vmm_offset = Vmm(13);
+    Vmm vmm_threshold = Vmm(14);
+
+    const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+    const Xbyak::Opmask k_tmp = Xbyak::Opmask(2);
+
+    jit_nms_iou_config_params jcp_;
+
+    // the arithmetic repeats NmsIou::iou operation by operation, so the vector and the scalar results are the same
+    inline void compute_iou(size_t offset) {
+        uni_vmovups(vmm_x1, ptr[reg_x1 + offset]);
+        uni_vmovups(vmm_y1, ptr[reg_y1 + offset]);
+        uni_vmovups(vmm_x2, ptr[reg_x2 + offset]);
+        uni_vmovups(vmm_y2, ptr[reg_y2 + offset]);
+        uni_vmovups(vmm_area, ptr[reg_area + offset]);
+
+        // the lanes to be zeroed
+        if (jcp_.type == NmsIouType::Matrix) {
+            cmp_ps(vmm_mask, k_mask, vmm_ref_x2, vmm_x1, _cmp_lt_os);
+            cmp_ps(vmm_tmp, k_tmp, vmm_x2, vmm_ref_x1, _cmp_lt_os);
+            or_mask();
+            cmp_ps(vmm_tmp, k_tmp, vmm_ref_y2, vmm_y1, _cmp_lt_os);
+            or_mask();
+            cmp_ps(vmm_tmp, k_tmp, vmm_y2, vmm_ref_y1, _cmp_lt_os);
+            or_mask();
+        } else {
+            cmp_ps(vmm_mask, k_mask, vmm_area, vmm_zero, _cmp_le_os);
+        }
+
+        uni_vminps(vmm_x2, vmm_x2, vmm_ref_x2);
+        uni_vmaxps(vmm_x1, vmm_x1, vmm_ref_x1);
+        uni_vsubps(vmm_x2, vmm_x2, vmm_x1);
+        uni_vaddps(vmm_x2, vmm_x2, vmm_offset);
+        uni_vminps(vmm_y2, vmm_y2, vmm_ref_y2);
+        uni_vmaxps(vmm_y1, vmm_y1, vmm_ref_y1);
+        uni_vsubps(vmm_y2, vmm_y2, vmm_y1);
+        uni_vaddps(vmm_y2, vmm_y2, vmm_offset);
+        if (jcp_.type == NmsIouType::Clamped) {
+            uni_vmaxps(vmm_x2, vmm_x2, vmm_zero);
+            uni_vmaxps(vmm_y2, vmm_y2, vmm_zero);
+        }
+        uni_vmulps(vmm_x2, vmm_x2, vmm_y2);
+
+        uni_vaddps(vmm_area, vmm_area, vmm_ref_area);
+        uni_vsubps(vmm_area, vmm_area, vmm_x2);
+        uni_vdivps(vmm_x2, vmm_x2, vmm_area);
+
+        if (isa == x64::sse41) {
+            andnps(vmm_mask, vmm_x2);
+            uni_vmovups(vmm_x2, vmm_mask);
+        } else if (isa == x64::avx2) {
+            vandnps(vmm_x2, vmm_mask, vmm_x2);
+        } else {
+            vblendmps(vmm_x2 | k_mask, vmm_x2, vmm_zero);
+        }
+    }
+
+    inline void cmp_ps(Vmm vmm_dst, const Xbyak::Opmask& k_dst, Vmm vmm_src0, Vmm vmm_src1, int pred) {
+        if (isa == x64::sse41) {
+            uni_vmovups(vmm_dst, vmm_src0);
+            cmpps(vmm_dst, vmm_src1, pred);
+        } else if (isa == x64::avx2) {
+            vcmpps(vmm_dst, vmm_src0, vmm_src1, pred);
+        } else {
+            vcmpps(k_dst, vmm_src0, vmm_src1, pred);
+        }
+    }
+
+    inline void or_mask() {
+        if (isa == x64::avx512_common)
+            korw(k_mask, k_mask, k_tmp);
+        else
+            uni_vorps(vmm_mask, vmm_mask, vmm_tmp);
+    }
+
+    inline void store_mask_bits(const Xbyak::Reg64& reg) {
+        if (isa == x64::sse41)
+            movmskps(reg.cvt32(), vmm_mask);
+        else if (isa == x64::avx2)
+            vmovmskps(reg.cvt32(), vmm_mask);
+        else
+            kmovw(reg.cvt32(), k_mask);
+    }
+};
+
+NmsIou::NmsIou(NmsIouType type, float offset) : type(type), offset(offset) {
+    auto createKernel = [&](bool suppress) {
+        auto jcp = jit_nms_iou_config_params();
+        jcp.type = type;
+        jcp.suppress = suppress;
+
+        std::shared_ptr<jit_uni_nms_iou_kernel> kernel;
+        if (mayiuse(x64::avx512_common)) {
+            kernel.reset(new jit_uni_nms_iou_kernel_f32<x64::avx512_common>(jcp));
+            simdWidth = 16;
+        } else if (mayiuse(x64::avx2)) {
+            kernel.reset(new jit_uni_nms_iou_kernel_f32<x64::avx2>(jcp));
+            simdWidth = 8;
+        } else if (mayiuse(x64::sse41)) {
+            kernel.reset(new jit_uni_nms_iou_kernel_f32<x64::sse41>(jcp));
+            simdWidth = 4;
+        }
+        if (kernel)
+            kernel->create_ker();
+        return kernel;
+    };
+
+    suppressKernel = createKernel(true);
+    computeKernel = createKernel(false);
+}
+
+float NmsIou::area(float x1, float y1, float x2, float y2) const {
+    if (type == NmsIouType::Matrix && (x2 < x1 || y2 < y1))
+        return 0.f;
+    return (x2 - x1 + offset) * (y2 - y1 + offset);
+}
+
+float NmsIou::iou(const NmsBoxesSoA& boxes, size_t i, size_t j) const {
+    if (type == NmsIouType::Matrix) {
+        if (boxes.x2[i] < boxes.x1[j] || boxes.x2[j] < boxes.x1[i] || boxes.y2[i] < boxes.y1[j] || boxes.y2[j] < boxes.y1[i])
+            return 0.f;
+    } else if (boxes.area[i] <= 0.f || boxes.area[j] <= 0.f) {
+        return 0.f;
+    }
+
+    float width = std::min(boxes.x2[j], boxes.x2[i]) - std::max(boxes.x1[j], boxes.x1[i]) + offset;
+    float height = std::min(boxes.y2[j], boxes.y2[i]) - std::max(boxes.y1[j], boxes.y1[i]) + offset;
+    if (type == NmsIouType::Clamped) {
+        width = std::max(width, 0.f);
+        height = std::max(height, 0.f);
+    }
+    const float intersection = width * height;
+    return intersection / (boxes.area[j] + boxes.area[i] - intersection);
+}
+
+void NmsIou::suppress(const NmsBoxesSoA& boxes, size_t idx, size_t begin, size_t end, float threshold, uint64_t* mask) const {
+    if (begin >= end)
+        return;
+    begin = begin / NmsBoxesSoA::block * NmsBoxesSoA::block;
+
+    auto suppressScalar = [&](size_t start, size_t stop, bool zeroIou) {
+        for (size_t j = start; j < stop; j++) {
+            const float value = zeroIou ? 0.f : iou(boxes, idx, j);
+            if (value >= threshold)
+                mask[j / NmsBoxesSoA::block] |= static_cast<uint64_t>(1) << (j % NmsBoxesSoA::block);
+        }
+    };
+
+    // the kernel doesn't check the area of the box it compares with
+    if (type == NmsIouType::Clamped && boxes.area[idx] <= 0.f) {
+        suppressScalar(begin, end, true);
+        return;
+    }
+    if (!suppressKernel) {
+        suppressScalar(begin, end, false);
+        return;
+    }
+
+    auto suppressBlocks = [&](size_t startBlock, size_t stopBlock) {
+        const size_t start = begin + startBlock * NmsBoxesSoA::block;
+        auto args = jit_args_nms_iou();
+        args.x1 = boxes.x1.data() + start;
+        args.y1 = boxes.y1.data() + start;
+        args.x2 = boxes.x2.data() + start;
+        args.y2 = boxes.y2.data() + start;
+        args.area = boxes.area.data() + start;
+        args.dst = mask + start / NmsBoxesSoA::block;
+        args.work_amount = stopBlock - startBlock;
+        args.ref_x1 = boxes.x1[idx];
+        args.ref_y1 = boxes.y1[idx];
+        args.ref_x2 = boxes.x2[idx];
+        args.ref_y2 = boxes.y2[idx];
+        args.ref_area = boxes.area[idx];
+        args.offset = offset;
+        args.threshold = threshold;
+        (*suppressKernel)(&args);
+    };
+
+    const size_t blocks = div_up(end - begin, NmsBoxesSoA::block);
+    if (blocks < minParallelBlocks) {
+        suppressBlocks(0, blocks);
+    } else {
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, stop = 0;
+            splitter(blocks, nthr, ithr, start, stop);
+            if (start < stop)
+                suppressBlocks(start, stop);
+        });
+    }
+}
+
+void NmsIou::compute(const NmsBoxesSoA& boxes, size_t idx, size_t count, float* dst) const {
+    if (type == NmsIouType::Clamped && boxes.area[idx] <= 0.f) {
+        std::fill(dst, dst + count, 0.f);
+        return;
+    }
+
+    size_t tail = 0;
+    if (computeKernel) {
+        auto args = jit_args_nms_iou();
+        args.x1 = boxes.x1.data();
+        args.y1 = boxes.y1.data();
+        args.x2 = boxes.x2.data();
+        args.y2 = boxes.y2.data();
+        args.area = boxes.area.data();
+        args.dst = dst;
+        args.work_amount = count / simdWidth;
+        args.ref_x1 = boxes.x1[idx];
+        args.ref_y1 = boxes.y1[idx];
+        args.ref_x2 = boxes.x2[idx];
+        args.ref_y2 = boxes.y2[idx];
+        args.ref_area = boxes.area[idx];
+        args.offset = offset;
+        (*computeKernel)(&args);
+        tail = args.work_amount * simdWidth;
+    }
+    for (size_t j = tail; j < count; j++) {
+        dst[j] = iou(boxes, idx, j);
+    }
+}
@@ -0,0 +1,139 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+struct jit_uni_nms_iou_kernel;
+
+/**
+ * The boxes of one (batch, class) pair in the order of the decreasing score, stored as the structure of arrays,
+ * so the IoU of a box with the following ones is computed by vectors. The arrays are padded to the block of 64 boxes
+ * processed by the kernel.
+ */
+struct NmsBoxesSoA {
+    static constexpr size_t block = 64;
+
+    void resize(size_t size) {
+        const size_t padded = (size + block - 1) / block * block;
+        for (auto vec : {&x1, &y1, &x2, &y2, &area})
+            vec->assign(padded, 0.f);
+    }
+
+    std::vector<float> x1, y1, x2, y2, area;
+};
+
+enum class NmsIouType {
+    // the intersection is clamped to zero and the boxes of non-positive area don't intersect anything
+    // (NonMaxSuppression, MulticlassNms)
+    Clamped,
+    // the boxes not overlapping by the coordinates don't intersect (MatrixNms)
+    Matrix
+};
+
+/**
+ * IoU of the box with the following boxes. `offset` is added to the widths and heights of the boxes, it is 1 for the
+ * unnormalized (pixel) coordinates and 0 otherwise.
+ */
+class NmsIou {
+public:
+    NmsIou(NmsIouType type, float offset);
+
+    float area(float x1, float y1, float x2, float y2) const;
+
+    float iou(const NmsBoxesSoA& boxes, size_t i, size_t j) const;
+
+    /**
+     * @brief Sets the bits of the boxes [begin, end) whose IoU with the box `idx` is not less than the threshold
+     * @param mask one bit per box, bits of the boxes of the same block before begin may be set as well
+     */
+    void suppress(const NmsBoxesSoA& boxes, size_t idx, size_t begin, size_t end, float threshold, uint64_t* mask) const;
+
+    /**
+     * @brief Writes IoU of the box `idx` with the boxes [0, count) to dst
+     */
+    void compute(const NmsBoxesSoA& boxes, size_t idx, size_t count, float* dst) const;
+
+private:
+    NmsIouType type;
+    float offset;
+    size_t simdWidth = 1;
+    std::shared_ptr<jit_uni_nms_iou_kernel> suppressKernel;
+    std::shared_ptr<jit_uni_nms_iou_kernel> computeKernel;
+};
+
+struct NmsCandidate {
+    float score;
+    int idx;
+};
+
+/**
+ * Greedy hard NMS: the candidates are visited in the order of the decreasing score (the lower index first for the
+ * equal scores) and a candidate is selected if it is not suppressed by the selected ones. Each selected box marks
+ * the boxes it suppresses in the bitmask at once, using the vectorized IoU. Only the consumed part of the candidates
+ * is sorted: they are partitioned and sorted by growing chunks, which avoids sorting the whole list when
+ * maxOutputs is reached early.
+ * @param candidates the candidates that passed the score threshold, reordered by the function
+ * @param maxCandidates the number of the top scored candidates considered
+ * @param loadBox writes the corners (x1, y1, x2, y2) of the box by its index
+ */
+template <typename BoxLoader>
+void nmsSelectGreedy(std::vector<NmsCandidate>& candidates, size_t maxCandidates, size_t maxOutputs, float iouThreshold,
+                     const NmsIou& iou, const BoxLoader& loadBox, std::vector<NmsCandidate>& selected) {
+    selected.clear();
+    const size_t count = std::min(maxCandidates, candidates.size());
+    if (count == 0 || maxOutputs == 0)
+        return;
+
+    auto greater = [](const NmsCandidate& l, const NmsCandidate& r) {
+        return l.score > r.score || (l.score == r.score && l.idx < r.idx);
+    };
+
+    NmsBoxesSoA boxes;
+    boxes.resize(count);
+    std::vector<uint64_t> suppressed(boxes.x1.size() / NmsBoxesSoA::block, 0);
+    std::vector<size_t> selectedPos;
+
+    const size_t firstChunk = std::max<size_t>(4 * NmsBoxesSoA::block, 4 * std::min(count, maxOutputs));
+    size_t sorted = 0;
+    for (size_t i = 0; i < count && selected.size() < maxOutputs; i++) {
+        if (i == sorted) {
+            // the chunks are aligned to the blocks, so the kernel never touches the boxes that aren't loaded yet
+            size_t next = std::max(firstChunk, 2 * sorted);
+            next = std::min(count, (next + NmsBoxesSoA::block - 1) / NmsBoxesSoA::block * NmsBoxesSoA::block);
+            if (next < candidates.size())
+                std::nth_element(candidates.begin() + sorted, candidates.begin() + next, candidates.end(), greater);
+            std::sort(candidates.begin() + sorted, candidates.begin() + next, greater);
+
+            for (size_t j = sorted; j < next; j++) {
+                float x1, y1, x2, y2;
+                loadBox(candidates[j].idx, x1, y1, x2, y2);
+                boxes.x1[j] = x1;
+                boxes.y1[j] = y1;
+                boxes.x2[j] = x2;
+                boxes.y2[j] = y2;
+                boxes.area[j] = iou.area(x1, y1, x2, y2);
+            }
+            for (auto pos : selectedPos)
+                iou.suppress(boxes, pos, sorted, next, iouThreshold, suppressed.data());
+            sorted = next;
+        }
+
+        if ((suppressed[i / NmsBoxesSoA::block] >> (i % NmsBoxesSoA::block)) & 1)
+            continue;
+
+        selected.push_back(candidates[i]);
+        selectedPos.push_back(i);
+        if (selected.size() < maxOutputs)
+            iou.suppress(boxes, i, i + 1, sorted, iouThreshold, suppressed.data());
+    }
+}
+
+}  // namespace MKLDNNPlugin
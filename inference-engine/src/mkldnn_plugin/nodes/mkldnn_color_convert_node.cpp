@@ -0,0 +1,495 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <mkldnn_types.h>
+#include "ie_parallel.hpp"
+#include "mkldnn_color_convert_node.h"
+#include "mkldnn_input_node.h"
+#include <ngraph/opsets/opset8.hpp>
+#include <utils/general_utils.h>
+#include <cpu/x64/jit_generator.hpp>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_color_convert_call_args, field)
+
+namespace {
+
+// ITU-R BT.601 conversion of the limited range YUV values, the same as in the reference implementation
+constexpr float yScale = 1.164f;
+constexpr float yShift = -16.f * yScale;
+constexpr float uvShift = -128.f;
+// the coefficients of U and V for R, G and B channels
+constexpr float uCoefs[3] = {0.f, -0.391f, 2.018f};
+constexpr float vCoefs[3] = {1.596f, -0.813f, 0.f};
+
+}  // namespace
+
+/**
+ * The kernel converts a row of the image by vectors of N pixels. The result of N pixels is 3 * N values, i.e. three
+ * vectors, and the values of each output vector are gathered from the Y, U and V vectors by the permutation with
+ * the precomputed indices. The channel of each value of the output vector is known in advance as well, so the
+ * coefficients are precomputed per vector too.
+ */
+template <cpu_isa_t isa>
+struct jit_uni_color_convert_kernel_f32 : public jit_uni_color_convert_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_color_convert_kernel_f32)
+
+    explicit jit_uni_color_convert_kernel_f32(const jit_color_convert_config_params& jcp)
+        : jit_uni_color_convert_kernel(), jit_generator(), jcp_(jcp) {
+        prepare_table();
+    }
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_y, ptr[reg_params + GET_OFF(y)]);
+        mov(reg_u, ptr[reg_params + GET_OFF(u)]);
+        mov(reg_v, ptr[reg_params + GET_OFF(v)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_table, reinterpret_cast<size_t>(table.data()));
+
+        uni_vbroadcastss(vmm_y_scale, table_const(0));
+        uni_vbroadcastss(vmm_y_shift, table_const(1));
+        uni_vbroadcastss(vmm_uv_shift, table_const(2));
+        uni_vbroadcastss(vmm_max, table_const(3));
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        const size_t src_size = jcp_.src_prc.size();
+        const size_t dst_size = jcp_.dst_prc.size();
+        const size_t uv_step = jcp_.nv12 ? step : step / 2;
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label); {
+            cmp(reg_work_amount, step);
+            jl(exit_label, T_NEAR);
+
+            load_vector(vmm_y, ptr[reg_y], step);
+            uni_vfmadd213ps(vmm_y, vmm_y_scale, vmm_y_shift);
+
+            load_vector(vmm_u, ptr[reg_u], uv_step);
+            uni_vaddps(vmm_u, vmm_u, vmm_uv_shift);
+            if (!jcp_.nv12) {
+                load_vector(vmm_v, ptr[reg_v], uv_step);
+                uni_vaddps(vmm_v, vmm_v, vmm_uv_shift);
+            }
+            // U and V values of NV12 are interleaved, so both of them are taken from the same vector
+            const Vmm &vmm_v_src = jcp_.nv12 ? vmm_u : vmm_v;
+
+            for (size_t k = 0; k < 3; k++) {
+                uni_vmovups(vmm_idx, table_vec(k, idx_y));
+                vpermps(vmm_out, vmm_idx, vmm_y);
+
+                uni_vmovups(vmm_idx, table_vec(k, idx_u));
+                vpermps(vmm_aux, vmm_idx, vmm_u);
+                uni_vfmadd231ps(vmm_out, vmm_aux, table_vec(k, coef_u));
+
+                uni_vmovups(vmm_idx, table_vec(k, idx_v));
+                vpermps(vmm_aux, vmm_idx, vmm_v_src);
+                uni_vfmadd231ps(vmm_out, vmm_aux, table_vec(k, coef_v));
+
+                uni_vmaxps(vmm_out, vmm_out, vmm_zero);
+                uni_vminps(vmm_out, vmm_out, vmm_max);
+
+                store_vector(ptr[reg_dst + k * step * dst_size], k);
+            }
+
+            add(reg_y, step * src_size);
+            add(reg_u, uv_step * src_size);
+            if (!jcp_.nv12)
+                add(reg_v, uv_step * src_size);
+            add(reg_dst, 3 * step * dst_size);
+            sub(reg_work_amount, step);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+    }
+
+    static constexpr size_t step = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    // the vectors precomputed for every output vector
+    enum table_field {
+        idx_y,
+        idx_u,
+        idx_v,
+        coef_u,
+        coef_v,
+        scale,
+        shift,
+        fields_count
+    };
+
+    Xbyak::Address table_vec(size_t k, table_field field) {
+        return ptr[reg_table + (k * fields_count + field) * step * sizeof(float)];
+    }
+
+    Xbyak::Address table_const(size_t index) {
+        return ptr[reg_table + (3 * fields_count * step + index) * sizeof(float)];
+    }
+
+    void prepare_table() {
+        table.resize(3 * fields_count * step + 4);
+
+        const auto set_int = [&](size_t k, table_field field, size_t lane, int32_t value) {
+            std::memcpy(&table[(k * fields_count + field) * step + lane], &value, sizeof(value));
+        };
+        const auto set_float = [&](size_t k, table_field field, size_t lane, float value) {
+            table[(k * fields_count + field) * step + lane] = value;
+        };
+
+        for (size_t k = 0; k < 3; k++) {
+            for (size_t lane = 0; lane < step; lane++) {
+                const size_t pos = k * step + lane;
+                const auto pixel = static_cast<int32_t>(pos / 3);
+                const size_t channel = pos % 3;
+                const size_t rgb_channel = jcp_.bgr ? 2 - channel : channel;
+
+                set_int(k, idx_y, lane, pixel);
+                set_int(k, idx_u, lane, jcp_.nv12 ? pixel / 2 * 2 : pixel / 2);
+                set_int(k, idx_v, lane, jcp_.nv12 ? pixel / 2 * 2 + 1 : pixel / 2);
+                set_float(k, coef_u, lane, uCoefs[rgb_channel]);
+                set_float(k, coef_v, lane, vCoefs[rgb_channel]);
+                set_float(k, scale, lane, jcp_.scales[channel]);
+                set_float(k, shift, lane, jcp_.shifts[channel]);
+            }
+        }
+
+        const size_t consts = 3 * fields_count * step;
+        table[consts + 0] = yScale;
+        table[consts + 1] = yShift;
+        table[consts + 2] = uvShift;
+        table[consts + 3] = 255.f;
+    }
+
+    inline void load_vector(const Vmm &vmm_dst, const Xbyak::Address &op, size_t count) {
+        const Xbyak::Xmm xmm_dst = Xbyak::Xmm(vmm_dst.getIdx());
+        const Xbyak::Ymm ymm_dst = Xbyak::Ymm(vmm_dst.getIdx());
+
+        if (jcp_.src_prc == Precision::U8) {
+            if (count == step) {
+                vpmovzxbd(vmm_dst, op);
+            } else {
+                // half of the vector is loaded exactly to avoid reading past the end of the plane
+                if (isa == x64::avx2)
+                    vmovd(xmm_dst, op);
+                else
+                    vmovq(xmm_dst, op);
+                vpmovzxbd(vmm_dst, xmm_dst);
+            }
+            uni_vcvtdq2ps(vmm_dst, vmm_dst);
+        } else {
+            if (count == step) {
+                uni_vmovups(vmm_dst, op);
+            } else if (isa == x64::avx2) {
+                uni_vmovups(xmm_dst, op);
+            } else {
+                vmovups(ymm_dst, op);
+            }
+        }
+    }
+
+    inline void store_vector(const Xbyak::Address &op, size_t k) {
+        if (jcp_.dst_prc == Precision::U8) {
+            uni_vcvtps2dq(vmm_out, vmm_out);
+            if (isa == x64::avx512_common) {
+                vpmovusdb(op, vmm_out);
+            } else {
+                const Xbyak::Ymm ymm_out = Xbyak::Ymm(vmm_out.getIdx());
+                uni_vpackusdw(vmm_out, vmm_out, vmm_out);
+                vpermq(ymm_out, ymm_out, 0x08);
+                uni_vpackuswb(vmm_out, vmm_out, vmm_out);
+                vmovq(op, Xbyak::Xmm(vmm_out.getIdx()));
+            }
+            return;
+        }
+
+        if (jcp_.round_result)
+            uni_vroundps(vmm_out, vmm_out, 0);
+        uni_vmovups(vmm_aux, table_vec(k, scale));
+        uni_vfmadd213ps(vmm_out, vmm_aux, table_vec(k, shift));
+        uni_vmovups(op, vmm_out);
+    }
+
+    jit_color_convert_config_params jcp_;
+    std::vector<float> table;
+
+    Xbyak::Reg64 reg_y = r8;
+    Xbyak::Reg64 reg_u = r9;
+    Xbyak::Reg64 reg_v = r10;
+    Xbyak::Reg64 reg_dst = r11;
+    Xbyak::Reg64 reg_work_amount = r12;
+    Xbyak::Reg64 reg_table = r13;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_y = Vmm(0);
+    Vmm vmm_u = Vmm(1);
+    Vmm vmm_v = Vmm(2);
+    Vmm vmm_idx = Vmm(3);
+    Vmm vmm_out = Vmm(4);
+    Vmm vmm_aux = Vmm(5);
+    Vmm vmm_y_scale = Vmm(6);
+    Vmm vmm_y_shift = Vmm(7);
+    Vmm vmm_uv_shift = Vmm(8);
+    Vmm vmm_zero = Vmm(9);
+    Vmm vmm_max = Vmm(10);
+};
+
+bool MKLDNNColorConvertNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!one_of(op->get_type_info(),
+                ngraph::op::v8::NV12toRGB::get_type_info_static(),
+                ngraph::op::v8::NV12toBGR::get_type_info_static(),
+                ngraph::op::v8::I420toRGB::get_type_info_static(),
+                ngraph::op::v8::I420toBGR::get_type_info_static())) {
+            errorMessage = "Only opset8 NV12toRGB, NV12toBGR, I420toRGB and I420toBGR operations are supported";
+            return false;
+        }
+        if (!one_of(op->get_input_element_type(0), ngraph::element::u8, ngraph::element::f32)) {
+            errorMessage = "Only u8 and f32 precisions are supported";
+            return false;
+        }
+        if (op->get_output_partial_shape(0).rank().is_dynamic()) {
+            errorMessage = "Doesn't support op with dynamic rank";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNColorConvertNode::MKLDNNColorConvertNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                               MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "ColorConvert node with name '" + op->get_friendly_name() + "'";
+
+    const auto &typeInfo = op->get_type_info();
+    nv12 = one_of(typeInfo, ngraph::op::v8::NV12toRGB::get_type_info_static(), ngraph::op::v8::NV12toBGR::get_type_info_static());
+    bgr = one_of(typeInfo, ngraph::op::v8::NV12toBGR::get_type_info_static(), ngraph::op::v8::I420toBGR::get_type_info_static());
+    singlePlane = op->get_input_size() == 1;
+
+    if (!singlePlane && op->get_input_size() != (nv12 ? 2 : 3))
+        IE_THROW() << errorPrefix << " has incorrect number of input edges";
+}
+
+bool MKLDNNColorConvertNode::canFuse(const MKLDNNNodePtr& node) const {
+    if (getResultPrecision() != Precision::U8 && getResultPrecision() != Precision::FP32)
+        return false;
+
+    if (node->getType() == Convert) {
+        return fusedWith.empty() && node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32;
+    }
+
+    if (node->getType() != Eltwise || getResultPrecision() != Precision::FP32 ||
+        node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32 ||
+        !one_of(node->getAlgorithm(), EltwiseAdd, EltwiseSubtract, EltwiseMultiply, EltwiseDivide, EltwiseMulAdd))
+        return false;
+
+    // the data is expected on the first port, since Subtract and Divide are not commutative
+    if (node->getParentEdgesAtPort(0)[0]->getParent().get() != this || node->getInputShapeAtPort(0) != node->getOutputShapeAtPort(0))
+        return false;
+
+    const auto &outDims = getOutputShapeAtPort(0).getDims();
+    for (size_t i = 1; i < node->getParentEdges().size(); i++) {
+        const auto parent = node->getParentEdgesAtPort(i)[0]->getParent();
+        if (parent->getType() != Input || !parent->isConstant() || parent->getChildEdges().size() != 1)
+            return false;
+
+        // the values must be either per tensor or per channel, i.e. along the last dimension
+        const auto &constDims = node->getInputShapeAtPort(i).getDims();
+        const auto elementsCount = node->getInputShapeAtPort(i).getElementsCount();
+        if (elementsCount == 1)
+            continue;
+        if (elementsCount != 3 || constDims.empty() || constDims.back() != 3 || constDims.size() > outDims.size())
+            return false;
+    }
+
+    return true;
+}
+
+void MKLDNNColorConvertNode::appendScaleShift(const std::vector<float>& newScales, const std::vector<float>& newShifts) {
+    for (size_t c = 0; c < 3; c++) {
+        const float scale = newScales.empty() ? 1.f : newScales[newScales.size() == 1 ? 0 : c];
+        const float shift = newShifts.empty() ? 0.f : newShifts[newShifts.size() == 1 ? 0 : c];
+        scales[c] *= scale;
+        shifts[c] = shifts[c] * scale + shift;
+    }
+}
+
+Precision MKLDNNColorConvertNode::getResultPrecision() const {
+    return fusedWith.empty() ? getOriginalOutputPrecisionAtPort(0) : fusedWith.back()->getOriginalOutputPrecisionAtPort(0);
+}
+
+void MKLDNNColorConvertNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    srcPrc = getOriginalInputPrecisionAtPort(0);
+    if (srcPrc != Precision::U8)
+        srcPrc = Precision::FP32;
+
+    // the fused operations are computed in FP32, otherwise the result has the type of the input
+    dstPrc = fusedWith.empty() ? srcPrc : Precision::FP32;
+
+    std::vector<PortConfigurator> inConfs;
+    for (size_t i = 0; i < inputShapes.size(); i++)
+        inConfs.push_back({LayoutType::ncsp, srcPrc});
+
+    impl_desc_type implType = ref;
+    if (mayiuse(x64::avx512_common)) {
+        implType = jit_avx512;
+    } else if (mayiuse(x64::avx2)) {
+        implType = jit_avx2;
+    }
+
+    addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, dstPrc}}, implType);
+}
+
+void MKLDNNColorConvertNode::createPrimitive() {
+    jit_color_convert_config_params jcp;
+    jcp.nv12 = nv12;
+    jcp.bgr = bgr;
+    jcp.round_result = srcPrc == Precision::U8;
+    jcp.src_prc = srcPrc;
+    jcp.dst_prc = dstPrc;
+    jcp.scales = scales;
+    jcp.shifts = shifts;
+
+    if (mayiuse(x64::avx512_common)) {
+        kernel.reset(new jit_uni_color_convert_kernel_f32<x64::avx512_common>(jcp));
+        kernelStep = jit_uni_color_convert_kernel_f32<x64::avx512_common>::step;
+    } else if (mayiuse(x64::avx2)) {
+        kernel.reset(new jit_uni_color_convert_kernel_f32<x64::avx2>(jcp));
+        kernelStep = jit_uni_color_convert_kernel_f32<x64::avx2>::step;
+    }
+
+    if (kernel)
+        kernel->create_ker();
+}
+
+template <typename src_t, typename dst_t>
+void MKLDNNColorConvertNode::convertRow(const src_t* y, const src_t* u, const src_t* v, dst_t* dst, size_t start, size_t end) const {
+    const auto clip = [](float value) {
+        return std::min(std::max(value, 0.f), 255.f);
+    };
+
+    for (size_t w = start; w < end; w++) {
+        const float yValue = static_cast<float>(y[w]) * yScale + yShift;
+        const size_t uvIndex = nv12 ? w / 2 * 2 : w / 2;
+        const float uValue = static_cast<float>(u[uvIndex]) + uvShift;
+        const float vValue = static_cast<float>(v[uvIndex]) + uvShift;
+
+        for (size_t c = 0; c < 3; c++) {
+            const size_t rgbChannel = bgr ? 2 - c : c;
+            float value = clip(yValue + uCoefs[rgbChannel] * uValue + vCoefs[rgbChannel] * vValue);
+            // the JIT kernel rounds half to even (vroundps/vcvtps2dq), which std::nearbyint does in the default mode
+            if (std::is_integral<src_t>::value)
+                value = std::nearbyint(value);
+            value = value * scales[c] + shifts[c];
+            if (std::is_integral<dst_t>::value)
+                value = std::nearbyint(value);
+            dst[w * 3 + c] = static_cast<dst_t>(value);
+        }
+    }
+}
+
+template <typename src_t, typename dst_t>
+void MKLDNNColorConvertNode::convert() {
+    const auto &dstDims = getChildEdgeAt(0)->getMemory().getStaticDims();
+    if (dstDims.size() != 4)
+        IE_THROW() << errorPrefix << " has unexpected output rank: " << dstDims.size();
+
+    const size_t batch = dstDims[0];
+    const size_t height = dstDims[1];
+    const size_t width = dstDims[2];
+    const size_t imageSize = height * width;
+
+    const auto y = reinterpret_cast<const src_t*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const src_t* u = nullptr;
+    const src_t* v = nullptr;
+    size_t yBatchStride = imageSize;
+    size_t uvBatchStride = 0;
+    if (singlePlane) {
+        yBatchStride = imageSize * 3 / 2;
+        uvBatchStride = yBatchStride;
+        u = y + imageSize;
+        v = nv12 ? u + 1 : u + imageSize / 4;
+    } else {
+        uvBatchStride = nv12 ? imageSize / 2 : imageSize / 4;
+        u = reinterpret_cast<const src_t*>(getParentEdgeAt(1)->getMemoryPtr()->GetPtr());
+        v = nv12 ? u + 1 : reinterpret_cast<const src_t*>(getParentEdgeAt(2)->getMemoryPtr()->GetPtr());
+    }
+    // NV12 row of the UV plane contains interleaved U and V values for the pairs of pixels
+    const size_t uvRowStride = nv12 ? width : width / 2;
+
+    auto dst = reinterpret_cast<dst_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t vectorized = kernel ? width / kernelStep * kernelStep : 0;
+
+    parallel_for2d(batch, height, [&](size_t n, size_t h) {
+        const src_t* yRow = y + n * yBatchStride + h * width;
+        const src_t* uRow = u + n * uvBatchStride + h / 2 * uvRowStride;
+        const src_t* vRow = v + n * uvBatchStride + h / 2 * uvRowStride;
+        dst_t* dstRow = dst + (n * imageSize + h * width) * 3;
+
+        if (vectorized != 0) {
+            jit_color_convert_call_args args;
+            args.y = yRow;
+            args.u = uRow;
+            args.v = vRow;
+            args.dst = dstRow;
+            args.work_amount = vectorized;
+            (*kernel)(&args);
+        }
+
+        convertRow(yRow, uRow, vRow, dstRow, vectorized, width);
+    });
+}
+
+void MKLDNNColorConvertNode::execute(mkldnn::stream strm) {
+    if (srcPrc == Precision::U8 && dstPrc == Precision::U8) {
+        convert<uint8_t, uint8_t>();
+    } else if (srcPrc == Precision::U8 && dstPrc == Precision::FP32) {
+        convert<uint8_t, float>();
+    } else if (srcPrc == Precision::FP32 && dstPrc == Precision::FP32) {
+        convert<float, float>();
+    } else {
+        IE_THROW() << errorPrefix << " doesn't support conversion from " << srcPrc.name() << " to " << dstPrc.name();
+    }
+}
+
+bool MKLDNNColorConvertNode::created() const {
+    return getType() == ColorConvert;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNColorConvertNode, ColorConvert);
@@ -0,0 +1,96 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+struct jit_color_convert_call_args {
+    const void* y;
+    const void* u;
+    const void* v;  // unused for NV12, where U and V values are interleaved in the plane pointed by u
+    void* dst;
+    size_t work_amount;  // number of pixels, multiple of the vector length
+};
+
+struct jit_color_convert_config_params {
+    bool nv12;
+    bool bgr;
+    bool round_result;  // the result is rounded as it would be stored to the integer type
+    InferenceEngine::Precision src_prc;
+    InferenceEngine::Precision dst_prc;
+    std::vector<float> scales;  // per output channel
+    std::vector<float> shifts;  // per output channel
+};
+
+struct jit_uni_color_convert_kernel {
+    void (*ker_)(const jit_color_convert_call_args *);
+
+    void operator()(const jit_color_convert_call_args *args) { assert(ker_); ker_(args); }
+
+    virtual void create_ker() = 0;
+
+    jit_uni_color_convert_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_color_convert_kernel() {}
+};
+
+/**
+ * Converts NV12 and I420 images to RGB or BGR ones. The following Convert to FP32 and the per-channel
+ * Add/Subtract/Multiply/Divide operations (e.g. mean and scale normalization) may be fused into the node.
+ */
+class MKLDNNColorConvertNode : public MKLDNNNode {
+public:
+    MKLDNNColorConvertNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+    bool canFuse(const MKLDNNNodePtr& node) const override;
+
+    /**
+     * @brief Appends the per-channel affine transformation to the result of the node, the values are broadcasted if
+     * there is a single one
+     */
+    void appendScaleShift(const std::vector<float>& scales, const std::vector<float>& shifts);
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+protected:
+    bool needPrepareParams() const override { return false; }
+    void executeDynamicImpl(mkldnn::stream strm) override { execute(strm); }
+
+private:
+    template <typename src_t, typename dst_t>
+    void convertRow(const src_t* y, const src_t* u, const src_t* v, dst_t* dst, size_t start, size_t end) const;
+
+    template <typename src_t, typename dst_t>
+    void convert();
+
+    InferenceEngine::Precision getResultPrecision() const;
+
+    bool nv12 = true;
+    bool bgr = false;
+    bool singlePlane = true;
+
+    InferenceEngine::Precision srcPrc;
+    InferenceEngine::Precision dstPrc;
+
+    std::vector<float> scales = {1.f, 1.f, 1.f};
+    std::vector<float> shifts = {0.f, 0.f, 0.f};
+
+    std::shared_ptr<jit_uni_color_convert_kernel> kernel;
+    size_t kernelStep = 0;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
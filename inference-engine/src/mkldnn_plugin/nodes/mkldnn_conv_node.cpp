@@ -947,42 +947,44 @@ void MKLDNNConvolutionNode::prepareParams() {
         pAttrLocal = initPrimitiveAttr();
     }
 
-    std::shared_ptr<mkldnn::convolution_forward::desc> dnnlConvDesc;
-    auto alg = isWinograd() ? mkldnn::algorithm::convolution_winograd : mkldnn::algorithm::convolution_direct;
+    prim = getOrCreatePrimitive([&]() {
+        std::shared_ptr<mkldnn::convolution_forward::desc> dnnlConvDesc;
+        auto alg = isWinograd() ? mkldnn::algorithm::convolution_winograd : mkldnn::algorithm::convolution_direct;
 
-    if (withBiases) {
-        auto biasMemoryDesc = getParentEdgesAtPort(2).front()->getMemory().GetDescWithType<DnnlMemoryDesc>();
-        // WA to align IR bias representation (3 to 5 rank tensors) to oneDNN representation (1 rank tensor)
-        mkldnn::memory::desc dnnlBiasDesc = biasMemoryDesc->getDnnlDesc().reshape(MKLDNNExtensionUtils::convertToDnnlDims(biasesDims));
-        dnnlConvDesc = createDescriptorInternal(inMemoryDesc->getDnnlDesc(),
-                                                weightMemoryDesc->getDnnlDesc(),
-                                                dnnlBiasDesc,
-                                                outMemoryDesc->getDnnlDesc(),
-                                                alg);
-    } else {
-        dnnlConvDesc = createDescriptorInternal(inMemoryDesc->getDnnlDesc(),
-                                                weightMemoryDesc->getDnnlDesc(),
-                                                outMemoryDesc->getDnnlDesc(),
-                                                alg);
-    }
+        if (withBiases) {
+            auto biasMemoryDesc = getParentEdgesAtPort(2).front()->getMemory().GetDescWithType<DnnlMemoryDesc>();
+            // WA to align IR bias representation (3 to 5 rank tensors) to oneDNN representation (1 rank tensor)
+            mkldnn::memory::desc dnnlBiasDesc = biasMemoryDesc->getDnnlDesc().reshape(MKLDNNExtensionUtils::convertToDnnlDims(biasesDims));
+            dnnlConvDesc = createDescriptorInternal(inMemoryDesc->getDnnlDesc(),
+                                                    weightMemoryDesc->getDnnlDesc(),
+                                                    dnnlBiasDesc,
+                                                    outMemoryDesc->getDnnlDesc(),
+                                                    alg);
+        } else {
+            dnnlConvDesc = createDescriptorInternal(inMemoryDesc->getDnnlDesc(),
+                                                    weightMemoryDesc->getDnnlDesc(),
+                                                    outMemoryDesc->getDnnlDesc(),
+                                                    alg);
+        }
 
-    MKLDNNDescriptor desc(dnnlConvDesc);
+        MKLDNNDescriptor desc(dnnlConvDesc);
 
-    auto itpd = desc.createPrimitiveDescriptorIterator(getEngine(), *pAttrLocal);
+        auto itpd = desc.createPrimitiveDescriptorIterator(getEngine(), *pAttrLocal);
 
-    convolution_forward::primitive_desc prim_desc;
-    while (static_cast<bool>(itpd))  {
-        impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
+        convolution_forward::primitive_desc prim_desc;
+        while (static_cast<bool>(itpd))  {
+            impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
 
-        if (impl_type == selected_pd->getImplementationType()) {
-            prim_desc = convolution_forward::primitive_desc(itpd.get());
-            break;
+            if (impl_type == selected_pd->getImplementationType()) {
+                prim_desc = convolution_forward::primitive_desc(itpd.get());
+                break;
+            }
+            if (!itpd.next_impl())
+                IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
         }
-        if (!itpd.next_impl())
-            IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
-    }
 
-    prim.reset(new convolution_forward(prim_desc));
+        return std::make_shared<convolution_forward>(prim_desc);
+    });
 
     primArgs[DNNL_ARG_SRC] = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     primArgs[DNNL_ARG_WEIGHTS] = getWeights();
@@ -159,18 +159,34 @@ struct jit_uni_eltwise_generic : public MKLDNNPlugin::jit_uni_eltwise_kernel, pu
             }
         };
 
+        auto init_ptrs_with_runtime_offsets = [this, offset_count](Reg64 pointer, size_t offsets_arg) {
+            mov(reg_offsets, ptr[reg_const_params + offsets_arg]);
+            for (int j = 0; j < offset_count; j++) {
+                mov(reg_tmp_64, ptr[reg_offsets + j * sizeof(size_t)]);
+                imul(reg_tmp_64, ptr[reg_indexes + j * sizeof(size_t)]);
+                add(pointer, reg_tmp_64);
+            }
+        };
+
         for (int i = 0; i < jep.inputs_number; i++) {
             mov(get_src_reg(i), ptr[reg_const_params + GET_OFF(src_ptr[0]) + i * sizeof(size_t)]);
-            init_ptrs_with_offsets(get_src_reg(i), jep.src_offsets[i]);
+            if (jep.use_runtime_ptrs)
+                init_ptrs_with_runtime_offsets(get_src_reg(i), GET_OFF(src_offsets[0]) + i * sizeof(size_t));
+            else
+                init_ptrs_with_offsets(get_src_reg(i), jep.src_offsets[i]);
         }
 
         mov(reg_dst, ptr[reg_const_params + GET_OFF(dst_ptr)]);
-        init_ptrs_with_offsets(reg_dst, jep.dst_offsets);
-
         xor_(reg_oc_off, reg_oc_off);
-        init_ptrs_with_offsets(reg_oc_off, jep.oc_offsets);
-
-        mov(reg_work_amount, jep.work_amount);
+        if (jep.use_runtime_ptrs) {
+            init_ptrs_with_runtime_offsets(reg_dst, GET_OFF(dst_offsets));
+            init_ptrs_with_runtime_offsets(reg_oc_off, GET_OFF(oc_offsets));
+            mov(reg_work_amount, ptr[reg_const_params + GET_OFF(work_amount)]);
+        } else {
+            init_ptrs_with_offsets(reg_dst, jep.dst_offsets);
+            init_ptrs_with_offsets(reg_oc_off, jep.oc_offsets);
+            mov(reg_work_amount, jep.work_amount);
+        }
 
         Xbyak::Label unroll_loop_label;
         Xbyak::Label unroll_loop_end_label;
@@ -195,7 +211,8 @@ struct jit_uni_eltwise_generic : public MKLDNNPlugin::jit_uni_eltwise_kernel, pu
         if (jep_.oc_size > 1)
             min_src_size = std::min(min_src_size, jep_.oc_size);
 
-        if (min_src_size != jep.dst_size) {
+        // the inputs of the shape agnostic kernel are either broadcasted along the innermost dim or not
+        if (!jep.use_runtime_ptrs && min_src_size != jep.dst_size) {
             bool is_valid_configuration = true;
             if (jep.dst_size % min_src_size != 0)
                 is_valid_configuration = false;
@@ -261,7 +278,7 @@ struct jit_uni_eltwise_generic : public MKLDNNPlugin::jit_uni_eltwise_kernel, pu
             L(unroll_loop_end_label);
         }
 
-        if (min_src_size == jep.dst_size) {
+        if (jep.use_runtime_ptrs || min_src_size == jep.dst_size) {
             L(main_loop_label);
             {
                 size_t loop_step = cpu_isa_traits<isa>::vlen / exec_prc.size();
@@ -368,6 +385,9 @@ private:
     Reg32 reg_tmp_32 = Reg32(r15.getIdx());
     Reg64 reg_tmp_64 = Reg64(r15.getIdx());
 
+    // used only on the pointers initialization
+    Reg64 reg_offsets = rax;
+
     Reg64 reg_d_weights = rbp;
     Reg64 reg_d_bias = rsi;
 
@@ -791,6 +811,26 @@ private:
     }
 };
 
+namespace {
+
+std::shared_ptr<jit_uni_eltwise_kernel> createEltwiseKernel(const jit_eltwise_params &jep, MKLDNNEltwiseNode& node) {
+    std::shared_ptr<jit_uni_eltwise_kernel> kernel;
+    if (mayiuse(x64::avx512_common)) {
+        kernel.reset(new jit_uni_eltwise_generic<x64::avx512_common>(jep, node));
+    } else if (mayiuse(x64::avx2)) {
+        kernel.reset(new jit_uni_eltwise_generic<x64::avx2>(jep, node));
+    } else if (mayiuse(x64::sse41)) {
+        kernel.reset(new jit_uni_eltwise_generic<x64::sse41>(jep, node));
+    } else {
+        IE_THROW() << "Can't create jit eltwise kernel";
+    }
+
+    kernel->create_ker();
+    return kernel;
+}
+
+}   // namespace
+
 const std::map<const ngraph::DiscreteTypeInfo, MKLDNNEltwiseNode::Initializer> MKLDNNEltwiseNode::initializers = {
     {ngraph::op::v1::Add::get_type_info_static(), [](const std::shared_ptr<ngraph::Node>& op, MKLDNNEltwiseNode& node) {
         node.algorithm = EltwiseAdd;
@@ -1480,7 +1520,31 @@ void MKLDNNEltwiseNode::prepareParams() {
                    [](size_t& offset) { return offset * sizeof(float);});
 
     if (canUseOptimizedImpl) {
-        execPtr = std::make_shared<EltwiseJitExecutor>(jep, *this, schedulerWorkAmount, batchDimIdx);
+        // the shapes of the dynamic node are not baked into the kernel, unless the innermost dims are partially
+        // broadcasted after the collapsing
+        jep.use_runtime_ptrs = isDynamicNode();
+        for (int i = 0; i < inputNum; i++) {
+            if (jep.src_size[i] != 1 && jep.src_size[i] != jep.dst_size)
+                jep.use_runtime_ptrs = false;
+        }
+        if (jep.oc_size > 1 && jep.oc_size != jep.dst_size)
+            jep.use_runtime_ptrs = false;
+
+        std::shared_ptr<jit_uni_eltwise_kernel> kernel;
+        if (jep.use_runtime_ptrs) {
+            size_t key = jep.input_size;
+            for (int i = 0; i < inputNum; i++)
+                key = (key << 1) | (jep.src_size[i] == 1 ? 1 : 0);
+            key = (key << 1) | (jep.oc_size > 1 ? 1 : 0);
+
+            auto& cachedKernel = kernelsCache[key];
+            if (!cachedKernel)
+                cachedKernel = createEltwiseKernel(jep, *this);
+            kernel = cachedKernel;
+        } else {
+            kernel = createEltwiseKernel(jep, *this);
+        }
+        execPtr = std::make_shared<EltwiseJitExecutor>(jep, kernel, schedulerWorkAmount, batchDimIdx);
     } else {
         execPtr = std::make_shared<EltwiseRefExecutor>(jep, fullWorkAmount, batchDimIdx);
     }
@@ -1542,7 +1606,7 @@ void MKLDNNEltwiseNode::offset_in_calc(VectorDims& offset, VectorDims& dims_in,
     }
 }
 
-void MKLDNNEltwiseNode::executeOptimized6D(const std::unique_ptr<jit_uni_eltwise_kernel> &pKernel, const jit_eltwise_call_args_ptrs &args_ptrs,
+void MKLDNNEltwiseNode::executeOptimized6D(const std::shared_ptr<jit_uni_eltwise_kernel> &pKernel, const jit_eltwise_call_args_ptrs &args_ptrs,
                                            const VectorDims &dims_out) const {
     parallel_for5d(dims_out[0], dims_out[1], dims_out[2], dims_out[3], dims_out[4],
         [&](size_t i0, size_t i1, size_t i2, size_t i3, size_t i4) {
@@ -1557,7 +1621,7 @@ void MKLDNNEltwiseNode::executeOptimized6D(const std::unique_ptr<jit_uni_eltwise
         });
 }
 
-void MKLDNNEltwiseNode::executeOptimizedGeneric(const std::unique_ptr<jit_uni_eltwise_kernel> &pKernel, const jit_eltwise_call_args_ptrs &args_ptrs,
+void MKLDNNEltwiseNode::executeOptimizedGeneric(const std::shared_ptr<jit_uni_eltwise_kernel> &pKernel, const jit_eltwise_call_args_ptrs &args_ptrs,
                                                 const VectorDims &dims_out, const size_t schedulerWorkAmount) const {
     parallel_nt(0, [&](const int ithr, const int nthr) {
         size_t start = 0, end = 0;
@@ -1886,30 +1950,27 @@ InferenceEngine::Precision MKLDNNEltwiseNode::getRuntimePrecision() const {
     return getMaxPrecision(inputPrecisions);
 }
 
-MKLDNNEltwiseNode::EltwiseJitExecutor::EltwiseJitExecutor(const jit_eltwise_params &_jep, MKLDNNEltwiseNode& node, const size_t schedWA, const size_t batch)
-                                                    : schedulerWorkAmount(schedWA), EltwiseExecutor(batch) {
-    if (mayiuse(x64::avx512_common)) {
-        pKernel.reset(new jit_uni_eltwise_generic<x64::avx512_common>(_jep, node));
-    } else if (mayiuse(x64::avx2)) {
-        pKernel.reset(new jit_uni_eltwise_generic<x64::avx2>(_jep, node));
-    } else if (mayiuse(x64::sse41)) {
-        pKernel.reset(new jit_uni_eltwise_generic<x64::sse41>(_jep, node));
-    } else {
-        IE_THROW() << "Can't create jit eltwise kernel";
-    }
-
-    if (pKernel)
-        pKernel->create_ker();
-}
+MKLDNNEltwiseNode::EltwiseJitExecutor::EltwiseJitExecutor(const jit_eltwise_params &_jep, std::shared_ptr<jit_uni_eltwise_kernel> kernel,
+                                                          const size_t schedWA, const size_t batch)
+                                                    : pKernel(std::move(kernel)), jep(_jep), schedulerWorkAmount(schedWA), EltwiseExecutor(batch) {}
 
 void MKLDNNEltwiseNode::EltwiseJitExecutor::exec(const MKLDNNEltwiseNode& node, const jit_eltwise_call_args_ptrs &args_ptrs, const VectorDims &dims_out) {
     if (!pKernel)
         IE_THROW() << "Can't execute, kernel for eltwise node is not compiled";
 
+    auto args = args_ptrs;
+    if (pKernel->jep_.use_runtime_ptrs) {
+        args.work_amount = jep.work_amount;
+        for (size_t i = 0; i < jep.inputs_number; i++)
+            args.src_offsets[i] = jep.src_offsets[i].data();
+        args.dst_offsets = jep.dst_offsets.data();
+        args.oc_offsets = jep.oc_offsets.data();
+    }
+
     if (pKernel->jep_.input_size == MKLDNNEltwiseNode::optimalTensorRank) {
-        node.executeOptimized6D(pKernel, args_ptrs, dims_out);
+        node.executeOptimized6D(pKernel, args, dims_out);
     } else {
-        node.executeOptimizedGeneric(pKernel, args_ptrs, dims_out, schedulerWorkAmount);
+        node.executeOptimizedGeneric(pKernel, args, dims_out, schedulerWorkAmount);
     }
 }
 
@@ -1920,7 +1981,7 @@ void MKLDNNEltwiseNode::EltwiseRefExecutor::exec(const MKLDNNEltwiseNode& node,
 const jit_eltwise_params& MKLDNNEltwiseNode::EltwiseJitExecutor::getJep() const {
     if (!pKernel)
         IE_THROW() << "Can't get jit eltwise params, kernel for eltwise node is not compiled";
-    return pKernel->jep_;
+    return jep;
 }
 
 REG_MKLDNN_PRIM_FOR(MKLDNNEltwiseNode, Eltwise);
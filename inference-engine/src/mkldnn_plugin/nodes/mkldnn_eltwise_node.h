@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <unordered_map>
 #include <caseless.hpp>
 
 namespace MKLDNNPlugin {
@@ -33,11 +34,21 @@ struct jit_eltwise_params {
     size_t oc_size;
 
     size_t work_amount;
+
+    // the offsets and the work amount are passed with the call arguments, so the kernel doesn't depend on the dims
+    // and is reused for any shape with the same broadcasting pattern
+    bool use_runtime_ptrs;
 };
 
 struct jit_eltwise_call_args_ptrs {
     const void *src_ptr[MAX_ELTWISE_INPUTS];
     void *dst_ptr;
+
+    // shape agnostic kernel
+    size_t work_amount;
+    const size_t *src_offsets[MAX_ELTWISE_INPUTS];
+    const size_t *dst_offsets;
+    const size_t *oc_offsets;
 };
 
 struct jit_eltwise_call_args_indexes {
@@ -112,11 +123,14 @@ private:
     executorPtr execPtr = nullptr;
 
     struct EltwiseJitExecutor : public EltwiseExecutor {
-        EltwiseJitExecutor(const jit_eltwise_params &_jep, MKLDNNEltwiseNode& node, const size_t schedWA, const size_t batch);
+        EltwiseJitExecutor(const jit_eltwise_params &_jep, std::shared_ptr<jit_uni_eltwise_kernel> kernel, const size_t schedWA,
+                           const size_t batch);
         void exec(const MKLDNNEltwiseNode& node, const jit_eltwise_call_args_ptrs &args_ptrs, const VectorDims &dims_out) override;
         const jit_eltwise_params& getJep() const override;
 
-        std::unique_ptr<jit_uni_eltwise_kernel> pKernel;
+        std::shared_ptr<jit_uni_eltwise_kernel> pKernel;
+        // the params of the current shape, they differ from the ones the kernel is compiled for if it is shape agnostic
+        jit_eltwise_params jep;
         size_t schedulerWorkAmount = 0;
     };
 
@@ -154,12 +168,15 @@ private:
 
     std::vector<MKLDNNMemoryPtr> memPtrs = {};
 
+    // the shape agnostic kernels of the dynamic node by the rank and the broadcasting pattern
+    std::unordered_map<size_t, std::shared_ptr<jit_uni_eltwise_kernel>> kernelsCache;
+
     using Initializer = std::function<void(const std::shared_ptr<ngraph::Node>&, MKLDNNEltwiseNode& node)>;
     static const std::map<const ngraph::DiscreteTypeInfo, Initializer> initializers;
 
-    void executeOptimized6D(const std::unique_ptr<jit_uni_eltwise_kernel> &pKernel, const jit_eltwise_call_args_ptrs &args_ptrs,
+    void executeOptimized6D(const std::shared_ptr<jit_uni_eltwise_kernel> &pKernel, const jit_eltwise_call_args_ptrs &args_ptrs,
                             const VectorDims &dims_out) const;
-    void executeOptimizedGeneric(const std::unique_ptr<jit_uni_eltwise_kernel> &pKernel, const jit_eltwise_call_args_ptrs &args_ptrs,
+    void executeOptimizedGeneric(const std::shared_ptr<jit_uni_eltwise_kernel> &pKernel, const jit_eltwise_call_args_ptrs &args_ptrs,
                                  const VectorDims &dims_out, const size_t schedulerWorkAmount) const;
     void executeReference(const jit_eltwise_params &jep, const jit_eltwise_call_args_ptrs &args_ptrs, const VectorDims &dims_out,
                           const size_t fullWorkAmount) const;
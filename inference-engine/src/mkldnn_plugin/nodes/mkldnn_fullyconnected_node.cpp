@@ -22,11 +22,6 @@ using namespace InferenceEngine;
 
 bool MKLDNNFullyConnectedNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         const auto fc = std::dynamic_pointer_cast<const FullyConnectedNode>(op);
         if (!fc) {
             errorMessage = "Only legacy FullyConnected operation is supported";
@@ -36,10 +31,23 @@ bool MKLDNNFullyConnectedNode::isSupportedOperation(const std::shared_ptr<const
             errorMessage = "Only Constant operation on 'bias' input is supported";
             return false;
         }
-        if (!one_of(fc->get_input_shape(DATA_ID).size(), 2, 3, 4)) {
-            errorMessage = "Doesn't support 'data' input with rank: " + std::to_string(fc->get_input_shape(DATA_ID).size());
+        const auto& inShape = fc->get_input_partial_shape(DATA_ID);
+        if (inShape.rank().is_dynamic()) {
+            errorMessage = "Doesn't support 'data' input with dynamic rank";
             return false;
         }
+        const auto inRank = inShape.rank().get_length();
+        if (!one_of(inRank, 2, 3, 4)) {
+            errorMessage = "Doesn't support 'data' input with rank: " + std::to_string(inRank);
+            return false;
+        }
+        // only the rows of the GEMM may be dynamic, the weights are prepacked for the static input channels
+        for (int64_t i = inRank == 3 ? 2 : 1; i < inRank; i++) {
+            if (inShape[i].is_dynamic()) {
+                errorMessage = "Doesn't support 'data' input with dynamic input channels";
+                return false;
+            }
+        }
     } catch (...) {
         return false;
     }
@@ -108,8 +116,10 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
         outputDataType = memory::data_type::bf16;
     }
 
-    const auto& inDims = getInputShapeAtPort(0).getStaticDims();
-    const auto& outDims = getOutputShapeAtPort(0).getStaticDims();
+    // the weights layout doesn't depend on the number of rows, so a dynamic node chooses it for the dummy one
+    // and the constant weights are reordered to it only once
+    const auto inDims = MemoryDescUtils::makeDummyShape(getInputShapeAtPort(DATA_ID)).getStaticDims();
+    const auto outDims = MemoryDescUtils::makeDummyShape(getOutputShapeAtPort(DATA_ID)).getStaticDims();
 
     if (inDims.size() == 3) {
         weightsDims = InferenceEngine::SizeVector({static_cast<size_t>(outDims[2]), static_cast<size_t>(inDims[2])});
@@ -129,23 +139,81 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
 }
 
 void MKLDNNFullyConnectedNode::createPrimitive() {
-    if (prim)
-        return;
+    if (inputShapesDefined()) {
+        if (needPrepareParams())
+            prepareParams();
+        updateLastInputDims();
+    }
+}
 
-    AttrPtr attr = initPrimitiveAttr();
-    std::shared_ptr<inner_product_forward::primitive_desc> prim_desc;
-    prim_desc = std::make_shared<inner_product_forward::primitive_desc>(
-            createPrimitiveDescriptor<inner_product_forward::primitive_desc, inner_product_forward::desc>(*attr));
+void MKLDNNFullyConnectedNode::prepareParams() {
+    auto srcMemPtr = getParentEdgesAtPort(DATA_ID)[0]->getMemoryPtr();
+    auto dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        IE_THROW() << errorPrefix << " did not allocate destination memory";
+    if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+        IE_THROW() << errorPrefix << " did not allocate input memory";
+
+    const NodeDesc *selected_pd = getSelectedPrimitiveDescriptor();
+    if (selected_pd == nullptr)
+        IE_THROW() << errorPrefix << " did not set preferable primitive descriptor";
+
+    AttrPtr attr;
+    if (isDynamicNode()) {
+        if (!pAttr) {
+            pAttr = initPrimitiveAttr();
+        }
+        attr = pAttr;
+    } else {
+        attr = initPrimitiveAttr();
+    }
 
-    prim.reset(new inner_product_forward(*prim_desc));
+    prim = getOrCreatePrimitive([&]() {
+        auto normalizeDesc = [](const mkldnn::memory::desc& desc) {
+            const auto& dims = desc.dims();
+            if (dims.size() == 3)
+                return desc.reshape({dims[0] * dims[1], dims[2]});
+            return desc;
+        };
 
-    auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
-    auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
+        const auto srcDesc = normalizeDesc(srcMemPtr->GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc());
+        const auto dstDesc = normalizeDesc(dstMemPtr->GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc());
+        // the weights are already prepacked to the selected layout, so only M is respecialized
+        const auto weightsDesc = getParentEdgeAt(WEIGHTS_ID)->getMemory().GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
+
+        std::shared_ptr<inner_product_forward::desc> fcDesc;
+        if (withBiases) {
+            const auto biasDesc = getParentEdgeAt(BIAS_ID)->getMemory().GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
+            fcDesc.reset(new inner_product_forward::desc(prop_kind::forward_scoring, srcDesc, weightsDesc, biasDesc, dstDesc));
+        } else {
+            fcDesc.reset(new inner_product_forward::desc(prop_kind::forward_scoring, srcDesc, weightsDesc, dstDesc));
+        }
+
+        MKLDNNDescriptor desc(fcDesc);
+        auto itpd = desc.createPrimitiveDescriptorIterator(getEngine(), *attr);
+
+        // all the implementations accept the fixed weights layout, so the first one is fine
+        // if the selected type doesn't support the current number of rows
+        inner_product_forward::primitive_desc prim_desc(itpd.get());
+        while (static_cast<bool>(itpd)) {
+            impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
+
+            if (impl_type == selected_pd->getImplementationType()) {
+                prim_desc = inner_product_forward::primitive_desc(itpd.get());
+                break;
+            }
+            if (!itpd.next_impl())
+                break;
+        }
+
+        return std::make_shared<inner_product_forward>(prim_desc);
+    });
+
+    primArgs[DNNL_ARG_SRC] = srcMemPtr->GetPrimitive();
+    primArgs[DNNL_ARG_WEIGHTS] = getParentEdgeAt(WEIGHTS_ID)->getMemory().GetPrimitive();
+    primArgs[DNNL_ARG_DST] = dstMemPtr->GetPrimitive();
     if (withBiases)
-        primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, getParentEdgeAt(WEIGHTS_ID)->getMemory().GetPrimitive()},
-                    {DNNL_ARG_BIAS, getParentEdgeAt(BIAS_ID)->getMemory().GetPrimitive()}, {DNNL_ARG_DST, dst}};
-    else
-        primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, getParentEdgeAt(WEIGHTS_ID)->getMemory().GetPrimitive()}, {DNNL_ARG_DST, dst}};
+        primArgs[DNNL_ARG_BIAS] = getParentEdgeAt(BIAS_ID)->getMemory().GetPrimitive();
 
     auto post_ops = attr->get_post_ops();
     int idx = 0;
@@ -179,6 +247,10 @@ void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
     }
 }
 
+void MKLDNNFullyConnectedNode::executeDynamicImpl(mkldnn::stream strm) {
+    execute(strm);
+}
+
 bool MKLDNNFullyConnectedNode::canFuse(const MKLDNNNodePtr& node) const {
     return canFuseSimpleOperation(node);
 }
@@ -211,9 +283,10 @@ void MKLDNNFullyConnectedNode::setPostOps(mkldnn::primitive_attr &attr, bool ini
 
         auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
         if (eltwiseNode) {
-            // TODO [DS]: change to shape from memory
+            // the per channel post ops data depends on the output channels only, which are static
             constexpr int align = -1;
-            eltwiseNode->appendPostOps(ops, getOutputShapeAtPort(0).getStaticDims(), align, initAsBinary, initBinaryMemory);
+            eltwiseNode->appendPostOps(ops, MemoryDescUtils::makeDummyShape(getOutputShapeAtPort(0)).getStaticDims(), align,
+                                       initAsBinary, initBinaryMemory);
             if (initBinaryMemory) {
                 if (eltwiseNode->scalesMemory)
                     binaryPostOpsArgs.push_back(eltwiseNode->scalesMemory->GetPrimitive());
@@ -336,8 +409,10 @@ void MKLDNNFullyConnectedNode::createDescriptorInternal(const mkldnn::memory::de
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                                 const std::vector<MemoryDescPtr> &outputDesc) {
-    createDescriptorInternal(MemoryDescUtils::convertToDnnlMemoryDesc(inputDesc[0])->getDnnlDesc(),
-                             MemoryDescUtils::convertToDnnlMemoryDesc(outputDesc[0])->getDnnlDesc());
+    auto inDesc = inputDesc[0]->isDefined() ? inputDesc[0] : MemoryDescUtils::makeDummyDesc(*inputDesc[0]);
+    auto outDesc = outputDesc[0]->isDefined() ? outputDesc[0] : MemoryDescUtils::makeDummyDesc(*outputDesc[0]);
+    createDescriptorInternal(MemoryDescUtils::convertToDnnlMemoryDesc(inDesc)->getDnnlDesc(),
+                             MemoryDescUtils::convertToDnnlMemoryDesc(outDesc)->getDnnlDesc());
 }
 
 std::shared_ptr<MemoryDesc> MKLDNNFullyConnectedNode::getSrcMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) {
@@ -347,6 +422,9 @@ std::shared_ptr<MemoryDesc> MKLDNNFullyConnectedNode::getSrcMemDesc(mkldnn::prim
         return std::make_shared<CpuBlockedMemoryDesc>(MKLDNNExtensionUtils::DataTypeToIEPrecision(
             static_cast<mkldnn::memory::data_type>(desc.data.data_type)), getInputShapeAtPort(idx));
     }
+    if (getInputShapeAtPort(idx).isDynamic()) {
+        return MKLDNNExtensionUtils::makeUndefinedDesc(desc, getInputShapeAtPort(idx));
+    }
     return MKLDNNExtensionUtils::makeDescriptor(desc);
 }
 
@@ -357,6 +435,9 @@ std::shared_ptr<MemoryDesc> MKLDNNFullyConnectedNode::getDstMemDesc(mkldnn::prim
         return std::make_shared<CpuBlockedMemoryDesc>(MKLDNNExtensionUtils::DataTypeToIEPrecision(
             static_cast<mkldnn::memory::data_type>(desc.data.data_type)), getOutputShapeAtPort(idx));
     }
+    if (getOutputShapeAtPort(idx).isDynamic()) {
+        return MKLDNNExtensionUtils::makeUndefinedDesc(desc, getOutputShapeAtPort(idx));
+    }
     return MKLDNNExtensionUtils::makeDescriptor(desc);
 }
 
@@ -20,6 +20,8 @@ public:
     void getSupportedDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
+    void prepareParams() override;
+    void executeDynamicImpl(mkldnn::stream strm) override;
     bool created() const override;
 
     bool canBeInPlace() const override {
@@ -57,6 +59,7 @@ private:
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights, bool initAsBinary);
 
     bool withBiases = false;
+    AttrPtr pAttr;
 
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
@@ -1864,6 +1864,11 @@ void MKLDNNInterpolateNode::initSupportedPrimitiveDescriptors() {
         inputPrecision = Precision::FP32;
     }
     Precision outputPrecision = inputPrecision;
+    // the input is integer while the output is not, if the preceding Convert was dropped by the graph optimizer
+    const auto originalOutputPrecision = getOriginalOutputPrecisionAtPort(DATA_ID);
+    if (one_of(inputPrecision, Precision::I8, Precision::U8) && originalOutputPrecision != inputPrecision) {
+        outputPrecision = (originalOutputPrecision == Precision::BF16 && mayiuse(avx512_core)) ? Precision::BF16 : Precision::FP32;
+    }
 
     if (!fusedWith.empty()) {
         outputPrecision = fusedWith[fusedWith.size() - 1]->getOriginalOutputPrecisionAtPort(DATA_ID);
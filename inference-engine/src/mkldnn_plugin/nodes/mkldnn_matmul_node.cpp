@@ -323,26 +323,28 @@ void MKLDNNMatMulNode::prepareParams() {
 
     auto dstDnnlDesc = dstMemPtr->GetDescWithType<DnnlMemoryDesc>();
 
-    MKLDNNDescriptor desc{
-            std::make_shared<matmul::desc>(src0TransposedDesc->getDnnlDesc(),
-                                           src1TransposedDesc->getDnnlDesc(),
-                                           dstDnnlDesc->getDnnlDesc())};
+    prim = getOrCreatePrimitive([&]() {
+        MKLDNNDescriptor desc{
+                std::make_shared<matmul::desc>(src0TransposedDesc->getDnnlDesc(),
+                                               src1TransposedDesc->getDnnlDesc(),
+                                               dstDnnlDesc->getDnnlDesc())};
 
-    matmul::primitive_desc prim_desc;
-    primitive_desc_iterator itpd = desc.createPrimitiveDescriptorIterator(getEngine(), *attr);
+        matmul::primitive_desc prim_desc;
+        primitive_desc_iterator itpd = desc.createPrimitiveDescriptorIterator(getEngine(), *attr);
 
-    while (static_cast<bool>(itpd))  {
-        impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
+        while (static_cast<bool>(itpd))  {
+            impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
 
-        if (impl_type == selected_pd->getImplementationType()) {
-            prim_desc = itpd.get();
-            break;
+            if (impl_type == selected_pd->getImplementationType()) {
+                prim_desc = itpd.get();
+                break;
+            }
+            if (!itpd.next_impl())
+                IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
         }
-        if (!itpd.next_impl())
-            IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
-    }
 
-    prim.reset(new matmul(prim_desc));
+        return std::make_shared<matmul>(prim_desc);
+    });
 
     primArgs[DNNL_ARG_SRC_0] = src0MemPtr->GetPrimitive();
     primArgs[DNNL_ARG_WEIGHTS_0] = src1MemPtr->GetPrimitive();
@@ -129,41 +129,6 @@ bool MKLDNNMatrixNmsNode::created() const {
     return getType() == MatrixNms;
 }
 
-namespace {
-
-static inline float boxArea(const float* bbox, const bool normalized) {
-    if (bbox[2] < bbox[0] || bbox[3] < bbox[1]) {
-        return static_cast<float>(0.);
-    } else {
-        const float width = bbox[2] - bbox[0];
-        const float height = bbox[3] - bbox[1];
-        if (normalized) {
-            return width * height;
-        } else {
-            return (width + 1) * (height + 1);
-        }
-    }
-}
-
-static inline float intersectionOverUnion(const float* bbox1, const float* bbox2, const bool normalized) {
-    if (bbox2[0] > bbox1[2] || bbox2[2] < bbox1[0] || bbox2[1] > bbox1[3] || bbox2[3] < bbox1[1]) {
-        return static_cast<float>(0.);
-    } else {
-        const float xMin = std::max(bbox1[0], bbox2[0]);
-        const float yMin = std::max(bbox1[1], bbox2[1]);
-        const float xMax = std::min(bbox1[2], bbox2[2]);
-        const float yMax = std::min(bbox1[3], bbox2[3]);
-        float norm = normalized ? static_cast<float>(0.) : static_cast<float>(1.);
-        float width = xMax - xMin + norm;
-        float height = yMax - yMin + norm;
-        const float interArea = width * height;
-        const float bbox1Area = boxArea(bbox1, normalized);
-        const float bbox2Area = boxArea(bbox2, normalized);
-        return interArea / (bbox1Area + bbox2Area - interArea);
-    }
-}
-}  // namespace
-
 size_t MKLDNNMatrixNmsNode::nmsMatrix(const float* boxesData, const float* scoresData, BoxInfo* filterBoxes, const int64_t batchIdx, const int64_t classIdx) {
     std::vector<int32_t> candidateIndex(m_numBoxes);
     std::iota(candidateIndex.begin(), candidateIndex.end(), 0);
@@ -183,19 +148,30 @@ size_t MKLDNNMatrixNmsNode::nmsMatrix(const float* boxesData, const float* score
         return scoresData[a] > scoresData[b];
     });
 
+    NmsBoxesSoA sortedBoxes;
+    sortedBoxes.resize(originalSize);
+    for (int64_t i = 0; i < originalSize; i++) {
+        const float* box = boxesData + candidateIndex[i] * 4;
+        sortedBoxes.x1[i] = box[0];
+        sortedBoxes.y1[i] = box[1];
+        sortedBoxes.x2[i] = box[2];
+        sortedBoxes.y2[i] = box[3];
+        sortedBoxes.area[i] = m_nmsIou->area(box[0], box[1], box[2], box[3]);
+    }
+
     std::vector<float> iouMatrix((originalSize * (originalSize - 1)) >> 1);
     std::vector<float> iouMax(originalSize);
 
     iouMax[0] = 0.;
     InferenceEngine::parallel_for(originalSize - 1, [&](size_t i) {
-        float max_iou = 0.;
         size_t actual_index = i + 1;
-        auto idx_a = candidateIndex[actual_index];
-        for (int64_t j = 0; j < actual_index; j++) {
-            auto idx_b = candidateIndex[j];
-            auto iou = intersectionOverUnion(boxesData + idx_a * 4, boxesData + idx_b * 4, m_normalized);
-            max_iou = std::max(max_iou, iou);
-            iouMatrix[actual_index * (actual_index - 1) / 2 + j] = iou;
+        // the row of the packed lower triangle is contiguous, so it is computed by vectors
+        float* iouRow = iouMatrix.data() + actual_index * (actual_index - 1) / 2;
+        m_nmsIou->compute(sortedBoxes, actual_index, actual_index, iouRow);
+        // the fold from zero skips the NaN of the boxes with zero area the same way as the scalar loop did
+        float max_iou = 0.;
+        for (size_t j = 0; j < actual_index; j++) {
+            max_iou = std::max(max_iou, iouRow[j]);
         }
         iouMax[actual_index] = max_iou;
     });
@@ -241,6 +217,7 @@ size_t MKLDNNMatrixNmsNode::nmsMatrix(const float* boxesData, const float* score
 }
 
 void MKLDNNMatrixNmsNode::createPrimitive() {
+    m_nmsIou = std::make_shared<NmsIou>(NmsIouType::Matrix, m_normalized ? 0.f : 1.f);
     if (inputShapesDefined()) {
         prepareParams();
         updateLastInputDims();
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "common/nms_kernel.h"
 
 #include <memory>
 #include <string>
@@ -92,6 +93,7 @@ private:
     std::vector<int64_t> m_numPerBatch;
     std::vector<std::vector<int64_t>> m_numPerBatchClass;
     std::vector<BoxInfo> m_filteredBoxes;
+    std::shared_ptr<NmsIou> m_nmsIou;
     std::vector<int> m_classOffset;
     size_t m_realNumClasses = 0;
     size_t m_realNumBoxes = 0;
@@ -149,7 +149,19 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
     return dataStore;
 }
 
+void MKLDNNMemoryInputNode::bindState(void* readPtr, void* writePtr) {
+    stateReadPtr = readPtr;
+    stateWritePtr = writePtr;
+}
+
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
+    if (stateWritePtr) {
+        IE_ASSERT(new_state.GetSize() == dataStore->GetSize()) << "Memory objects are not compatible. Has different sizes.";
+        // the input edge of the sibling MemoryOutput node may be bound to the state buffer, so there is nothing to copy
+        if (new_state.GetPtr() != stateWritePtr)
+            cpu_memcpy(stateWritePtr, new_state.GetPtr(), new_state.GetSize());
+        return;
+    }
     // TODO: Should be next one call:
     //           dataStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
@@ -157,10 +169,17 @@ void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    if (stateReadPtr) {
+        // the output edges may be bound to the state buffer, so there is nothing to copy
+        if (dstMemory.GetPtr() != stateReadPtr)
+            cpu_memcpy(dstMemory.GetPtr(), stateReadPtr, dstMemory.GetSize());
+        return;
+    }
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    simple_copy(dstMemory, *dataStore);
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
@@ -99,8 +99,15 @@ public:
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+    /**
+     * @brief Binds the buffers of the variable state of an infer request: the current value is read from readPtr
+     * and the sibling MemoryOutput node writes the new value to writePtr. Null pointers bind the internal store.
+     */
+    void bindState(void* readPtr, void* writePtr);
  private:
     MKLDNNMemoryPtr dataStore;
+    void* stateReadPtr = nullptr;
+    void* stateWritePtr = nullptr;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -106,6 +106,7 @@ void MKLDNNMultiClassNmsNode::initSupportedPrimitiveDescriptors() {
 }
 
 void MKLDNNMultiClassNmsNode::createPrimitive() {
+    m_nmsIou = std::make_shared<NmsIou>(NmsIouType::Clamped, m_normalized ? 0.f : 1.f);
     if (inputShapesDefined()) {
         prepareParams();
         updateLastInputDims();
@@ -396,40 +397,30 @@ void MKLDNNMultiClassNmsNode::nmsWithoutEta(const float* boxes, const float* sco
             const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
             const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-            std::vector<std::pair<float, int>> sorted_boxes;
+            std::vector<NmsCandidate> candidates;
             for (int box_idx = 0; box_idx < m_numBoxes; box_idx++) {
                 if (scoresPtr[box_idx] >= m_scoreThreshold)  // algin with ref
-                    sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
+                    candidates.push_back({scoresPtr[box_idx], box_idx});
             }
 
-            int io_selection_size = 0;
-            if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                });
-                int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
-                m_filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                int max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                            &boxesPtr[m_filtBoxes[offset + idx].box_index * 4], m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
-
-                    if (box_is_selected) {
-                        m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
-                            sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
-                }
+            // box format: y1, x1, y2, x2
+            auto loadBox = [&](int box_idx, float& x1, float& y1, float& x2, float& y2) {
+                const float* box = boxesPtr + box_idx * 4;
+                x1 = box[1];
+                y1 = box[0];
+                x2 = box[3];
+                y2 = box[2];
+            };
+
+            // only the top k candidates are considered, while any number of them may be selected
+            std::vector<NmsCandidate> selected;
+            nmsSelectGreedy(candidates, m_nmsRealTopk, candidates.size(), m_iouThreshold, *m_nmsIou, loadBox, selected);
+
+            int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
+            for (size_t i = 0; i < selected.size(); i++) {
+                m_filtBoxes[offset + i] = filteredBoxes(selected[i].score, batch_idx, class_idx, selected[i].idx);
             }
-            m_numFiltBox[batch_idx][class_idx] = io_selection_size;
+            m_numFiltBox[batch_idx][class_idx] = selected.size();
         }
     });
 }
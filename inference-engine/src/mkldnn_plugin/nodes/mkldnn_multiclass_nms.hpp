@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "common/nms_kernel.h"
 
 #include <string>
 
@@ -85,6 +86,7 @@ private:
     };
 
     std::vector<filteredBoxes> m_filtBoxes;
+    std::shared_ptr<NmsIou> m_nmsIou;
 
     void checkPrecision(const InferenceEngine::Precision prec, const std::vector<InferenceEngine::Precision> precList, const std::string name,
                         const std::string type);
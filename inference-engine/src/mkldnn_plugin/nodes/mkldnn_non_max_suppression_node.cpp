@@ -148,6 +148,7 @@ void MKLDNNNonMaxSuppressionNode::prepareParams() {
 }
 
 void MKLDNNNonMaxSuppressionNode::createPrimitive() {
+    nmsIou = std::make_shared<NmsIou>(NmsIouType::Clamped, 0.f);
     if (inputShapesDefined()) {
         prepareParams();
         updateLastInputDims();
@@ -362,43 +363,41 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
 
 void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const float *scores, const VectorDims &boxesStrides,
                                                                 const VectorDims &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
-    int max_out_box = static_cast<int>(max_output_boxes_per_class);
     parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
         const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-        std::vector<std::pair<float, int>> sorted_boxes;
+        std::vector<NmsCandidate> candidates;
         for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
             if (scoresPtr[box_idx] > score_threshold)
-                sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
+                candidates.push_back({scoresPtr[box_idx], box_idx});
         }
 
-        int io_selection_size = 0;
-        if (sorted_boxes.size() > 0) {
-            parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                          });
-            int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
-            filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-            io_selection_size++;
-            for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
-                bool box_is_selected = true;
-                for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                    float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4]);
-                    if (iou >= iou_threshold) {
-                        box_is_selected = false;
-                        break;
-                    }
-                }
-
-                if (box_is_selected) {
-                    filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
-                    io_selection_size++;
-                }
+        auto loadBox = [&](int box_idx, float& x1, float& y1, float& x2, float& y2) {
+            const float *box = boxesPtr + box_idx * 4;
+            if (boxEncodingType == boxEncoding::CENTER) {
+                //  box format: x_center, y_center, width, height
+                x1 = box[0] - box[2] / 2.f;
+                y1 = box[1] - box[3] / 2.f;
+                x2 = box[0] + box[2] / 2.f;
+                y2 = box[1] + box[3] / 2.f;
+            } else {
+                //  box format: y1, x1, y2, x2
+                x1 = (std::min)(box[1], box[3]);
+                y1 = (std::min)(box[0], box[2]);
+                x2 = (std::max)(box[1], box[3]);
+                y2 = (std::max)(box[0], box[2]);
             }
+        };
+
+        std::vector<NmsCandidate> selected;
+        nmsSelectGreedy(candidates, candidates.size(), max_output_boxes_per_class, iou_threshold, *nmsIou, loadBox, selected);
+
+        const size_t offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
+        for (size_t i = 0; i < selected.size(); i++) {
+            filtBoxes[offset + i] = filteredBoxes(selected[i].score, batch_idx, class_idx, selected[i].idx);
         }
-        numFiltBox[batch_idx][class_idx] = io_selection_size;
+        numFiltBox[batch_idx][class_idx] = selected.size();
     });
 }
 
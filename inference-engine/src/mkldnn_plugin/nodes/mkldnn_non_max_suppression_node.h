@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "common/nms_kernel.h"
 #include <string>
 #include <memory>
 #include <vector>
@@ -94,6 +95,7 @@ private:
     std::string errorPrefix;
 
     std::vector<std::vector<size_t>> numFiltBox;
+    std::shared_ptr<NmsIou> nmsIou;
     const std::string inType = "input", outType = "output";
 
     void checkPrecision(const Precision& prec, const std::vector<Precision>& precList, const std::string& name, const std::string& type);
@@ -234,23 +234,25 @@ void MKLDNNPoolingNode::prepareParams() {
         initEffectivePad(inDesc->getShape(), outDesc->getShape());
     }
 
-    mkldnn::algorithm alg = getPoolingAlgorithm();
-    MKLDNNDescriptor desc{createDescriptorInternal(in_candidate, out_candidate, alg)};
-    pooling_forward::primitive_desc prim_desc;
-    primitive_desc_iterator itpd = desc.createPrimitiveDescriptorIterator(getEngine(), *attr);
+    prim = getOrCreatePrimitive([&]() {
+        mkldnn::algorithm alg = getPoolingAlgorithm();
+        MKLDNNDescriptor desc{createDescriptorInternal(in_candidate, out_candidate, alg)};
+        pooling_forward::primitive_desc prim_desc;
+        primitive_desc_iterator itpd = desc.createPrimitiveDescriptorIterator(getEngine(), *attr);
 
-    while (static_cast<bool>(itpd))  {
-        impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
+        while (static_cast<bool>(itpd))  {
+            impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
 
-        if (impl_type == selected_pd->getImplementationType()) {
-            prim_desc = itpd.get();
-            break;
+            if (impl_type == selected_pd->getImplementationType()) {
+                prim_desc = itpd.get();
+                break;
+            }
+            if (!itpd.next_impl())
+                IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
         }
-        if (!itpd.next_impl())
-            IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
-    }
 
-    prim.reset(new pooling_forward(prim_desc));
+        return std::make_shared<pooling_forward>(prim_desc);
+    });
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -8,12 +8,77 @@
 #include "openvino/runtime/tensor.hpp"
 #include "common/blocked_desc_creator.h"
 #include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/validation_util.hpp>
+#include <openvino/op/util/convert_color_i420_base.hpp>
+#include <openvino/op/util/convert_color_nv12_base.hpp>
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <atomic>
+#include <numeric>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+
+// the evaluation of smaller tensors is not worth the threading overhead
+constexpr size_t parallelWorkThreshold = 4096;
+
+bool isElementwise(const std::shared_ptr<ngraph::Node>& op) {
+    return std::dynamic_pointer_cast<ngraph::op::util::UnaryElementwiseArithmetic>(op) ||
+           std::dynamic_pointer_cast<ngraph::op::util::BinaryElementwiseArithmetic>(op) ||
+           std::dynamic_pointer_cast<ngraph::op::util::BinaryElementwiseComparison>(op) ||
+           std::dynamic_pointer_cast<ngraph::op::util::BinaryElementwiseLogical>(op) ||
+           ov::is_type<ngraph::op::v1::LogicalNot>(op);
+}
+
+/**
+ * Returns the number of the leading inputs which may be split over the outermost dimension
+ * or 0 if the results for the different indices of this dimension are not independent
+ */
+size_t getOuterSplitInputsNum(const std::shared_ptr<ngraph::Node>& op) {
+    if (std::dynamic_pointer_cast<ov::op::util::ConvertColorNV12Base>(op) ||
+        std::dynamic_pointer_cast<ov::op::util::ConvertColorI420Base>(op))
+        return op->get_input_size();
+
+    if (const auto softmax = ov::as_type_ptr<ngraph::op::v1::Softmax>(op))
+        return softmax->get_axis() != 0 ? 1 : 0;
+
+    if (const auto logSoftmax = ov::as_type_ptr<ngraph::op::v5::LogSoftmax>(op)) {
+        const auto rank = op->get_input_partial_shape(0).rank();
+        if (rank.is_dynamic())
+            return 0;
+        const auto axis = logSoftmax->get_axis() < 0 ? logSoftmax->get_axis() + rank.get_length() : logSoftmax->get_axis();
+        return axis != 0 ? 1 : 0;
+    }
+
+    if (const auto reverse = ov::as_type_ptr<ngraph::op::v1::Reverse>(op)) {
+        const auto axes = ngraph::get_constant_from_source(op->input_value(1));
+        if (!axes)
+            return 0;
+        if (reverse->get_mode() == ngraph::op::v1::Reverse::Mode::MASK) {
+            const auto mask = axes->cast_vector<int64_t>();
+            return mask.empty() || mask[0] == 0 ? 1 : 0;
+        }
+        const auto rank = op->get_input_partial_shape(0).rank();
+        if (rank.is_dynamic())
+            return 0;
+        const auto indices = axes->cast_vector<int64_t>();
+        const bool reversesOuter = std::any_of(indices.begin(), indices.end(), [&rank](int64_t axis) {
+            return axis == 0 || axis + rank.get_length() == 0;
+        });
+        return reversesOuter ? 0 : 1;
+    }
+
+    return 0;
+}
+
+}  // namespace
+
 MKLDNNReferenceNode::MKLDNNReferenceNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache,
                                          const std::string& errorMessage) :
         MKLDNNNode(op, eng, cache), ngraphOp(op), additionalErrorMessage(errorMessage) {
@@ -29,6 +94,24 @@ MKLDNNReferenceNode::MKLDNNReferenceNode(const std::shared_ptr<ngraph::Node>& op
     if (ov::is_type<ngraph::op::v8::RandomUniform>(ngraphOp)) {
         constant = ConstantType::NoConst;
     }
+
+    const auto hasSubByteTypes = [](const std::vector<ov::element::Type>& types) {
+        return std::any_of(types.begin(), types.end(), [](const ov::element::Type& type) { return type.bitwidth() % 8 != 0; });
+    };
+    std::vector<ov::element::Type> types;
+    for (const auto& input : op->inputs())
+        types.push_back(input.get_element_type());
+    for (const auto& output : op->outputs())
+        types.push_back(output.get_element_type());
+
+    if (!hasSubByteTypes(types)) {
+        if (isElementwise(op) && op->get_output_size() == 1) {
+            parallelSplit = ParallelSplit::Flat;
+            splitInputsNum = op->get_input_size();
+        } else if ((splitInputsNum = getOuterSplitInputsNum(op)) != 0) {
+            parallelSplit = ParallelSplit::Outer;
+        }
+    }
 }
 
 void MKLDNNReferenceNode::getSupportedDescriptors() {}
@@ -55,6 +138,12 @@ void MKLDNNReferenceNode::initSupportedPrimitiveDescriptors() {
 void MKLDNNReferenceNode::createPrimitive() {}
 
 void MKLDNNReferenceNode::execute(mkldnn::stream strm) {
+    if (parallelSplit != ParallelSplit::None && executeInParallel()) {
+        lastExecutionPath = ExecutionPath::Parallel;
+        return;
+    }
+    lastExecutionPath = ExecutionPath::Sequential;
+
     ov::runtime::TensorVector inputs;
     for (size_t i = 0; i < inputShapes.size(); i++) {
         void *srcDataPtr = getParentEdgesAtPort(i)[0]->getMemory().GetPtr();
@@ -74,6 +163,80 @@ void MKLDNNReferenceNode::execute(mkldnn::stream strm) {
     }
 }
 
+bool MKLDNNReferenceNode::executeInParallel() {
+    const auto& dstDims = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
+    const size_t dstSize = std::accumulate(dstDims.begin(), dstDims.end(), size_t(1), std::multiplies<size_t>());
+
+    // number of the independent parts and the number of elements in every part of each port
+    size_t workAmount = 0;
+    std::vector<size_t> inStrides(inputShapes.size(), 0), outStrides(outputShapes.size(), 0);
+    if (parallelSplit == ParallelSplit::Flat) {
+        workAmount = dstSize;
+        for (size_t i = 0; i < inputShapes.size(); i++) {
+            if (getParentEdgesAtPort(i)[0]->getMemory().GetShape().getElementsCount() != dstSize)
+                return false;
+            inStrides[i] = 1;
+        }
+        outStrides[0] = 1;
+    } else {
+        if (dstDims.empty())
+            return false;
+        workAmount = dstDims[0];
+        for (size_t i = 0; i < outputShapes.size(); i++) {
+            const auto& dims = getChildEdgesAtPort(i)[0]->getMemory().getStaticDims();
+            if (dims.empty() || dims[0] != workAmount)
+                return false;
+            outStrides[i] = std::accumulate(dims.begin() + 1, dims.end(), size_t(1), std::multiplies<size_t>());
+        }
+        for (size_t i = 0; i < splitInputsNum; i++) {
+            const auto& dims = getParentEdgesAtPort(i)[0]->getMemory().getStaticDims();
+            if (dims.empty() || dims[0] != workAmount)
+                return false;
+            inStrides[i] = std::accumulate(dims.begin() + 1, dims.end(), size_t(1), std::multiplies<size_t>());
+        }
+    }
+
+    if (workAmount < 2 || dstSize < parallelWorkThreshold || parallel_get_max_threads() == 1)
+        return false;
+
+    const bool flat = parallelSplit == ParallelSplit::Flat;
+    const auto getPart = [flat](const MKLDNNMemory& mem, const ov::element::Type& type, size_t stride, size_t start, size_t end) {
+        if (stride == 0)
+            return ov::runtime::Tensor(type, mem.getStaticDims(), mem.GetPtr());
+
+        auto dims = mem.getStaticDims();
+        if (flat)
+            dims = {end - start};
+        else
+            dims[0] = end - start;
+        return ov::runtime::Tensor(type, dims, static_cast<uint8_t*>(mem.GetPtr()) + start * stride * type.size());
+    };
+
+    std::atomic<bool> success{true};
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(workAmount, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        ov::runtime::TensorVector inputs;
+        for (size_t i = 0; i < inputShapes.size(); i++)
+            inputs.push_back(getPart(getParentEdgesAtPort(i)[0]->getMemory(), ngraphOp->get_input_element_type(i), inStrides[i], start, end));
+
+        ov::runtime::TensorVector outputs;
+        for (size_t i = 0; i < outputShapes.size(); i++)
+            outputs.push_back(getPart(getChildEdgesAtPort(i)[0]->getMemory(), ngraphOp->get_output_element_type(i), outStrides[i], start, end));
+
+        if (!ngraphOp->evaluate(outputs, inputs))
+            success = false;
+    });
+
+    if (!success) {
+        IE_THROW() << "Evaluation failed on node of type: " << std::string(ngraphOp->get_type_name()) << " name: " << getName();
+    }
+    return true;
+}
+
 // TODO [DS]: rewrite after new shape infer will be added
 std::vector<VectorDims> MKLDNNReferenceNode::shapeInfer() const {
     ngraph::OutputVector inputsForShapeInfer;
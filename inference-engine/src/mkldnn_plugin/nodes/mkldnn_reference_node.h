@@ -23,8 +23,39 @@ public:
     bool needPrepareParams() const override { return false; }
     void executeDynamicImpl(mkldnn::stream strm) override;
 
+    const std::shared_ptr<ngraph::Node>& getReferenceOp() const { return ngraphOp; }
+
+    /**
+     * The way the op was evaluated on the last execution. Even if the op may be split between the threads, it is
+     * evaluated sequentially when the shapes don't allow the split or the work is too small.
+     */
+    enum class ExecutionPath {
+        NotExecuted,
+        Sequential,
+        Parallel
+    };
+
+    ExecutionPath getLastExecutionPath() const { return lastExecutionPath; }
+
 private:
+    /**
+     * The way the evaluation of the op may be split between the threads:
+     *  Flat - the op is element-wise, so any contiguous part of the output depends only on the same part of the inputs
+     *  Outer - every index of the outermost dimension of the output depends only on the same index of the first
+     *          splitInputsNum inputs, the other inputs are passed as is
+     */
+    enum class ParallelSplit {
+        None,
+        Flat,
+        Outer
+    };
+
+    bool executeInParallel();
+
     const std::shared_ptr<ngraph::Node> ngraphOp;
+    ParallelSplit parallelSplit = ParallelSplit::None;
+    size_t splitInputsNum = 0;
+    ExecutionPath lastExecutionPath = ExecutionPath::NotExecuted;
     const std::string additionalErrorMessage;
 };
 
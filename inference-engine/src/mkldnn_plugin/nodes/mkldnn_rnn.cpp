@@ -10,9 +10,14 @@
 #include "mkldnn_input_node.h"
 #include <mkldnn_extension_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "memory_desc/cpu_memory_desc_utils.h"
+#include "ie_parallel.hpp"
 
 #include <ngraph/node.hpp>
+#include <transformations/utils/utils.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <string>
 #include <utility>
 
@@ -99,6 +104,14 @@ inline bool haveCellState(mkldnn::algorithm alg) {
     return alg == mkldnn::algorithm::vanilla_lstm;
 }
 
+// the dims equal to Shape::UNDEFINED_DIM are dynamic
+static Shape makeShape(const VectorDims& dims) {
+    std::vector<ngraph::Dimension> ngraphDims;
+    for (const auto dim : dims)
+        ngraphDims.push_back(dim == Shape::UNDEFINED_DIM ? ngraph::Dimension::dynamic() : ngraph::Dimension(dim));
+    return Shape(ngraph::PartialShape(ngraphDims));
+}
+
 const std::map<InferenceEngine::Precision, InferenceEngine::Precision> MKLDNNRNN::weightsByLayerPrec {
     // layer precision,                weights precision
     {InferenceEngine::Precision::FP32, InferenceEngine::Precision::FP32},
@@ -110,11 +123,6 @@ const std::map<InferenceEngine::Precision, InferenceEngine::Precision> MKLDNNRNN
 
 bool MKLDNNRNN::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!one_of(op->get_type_info(),
                 ngraph::op::v3::GRUCell::get_type_info_static(),
                 ngraph::op::v0::LSTMCell::get_type_info_static(),
@@ -128,6 +136,23 @@ bool MKLDNNRNN::isSupportedOperation(const std::shared_ptr<const ngraph::Node>&
             return false;
         }
 
+        if (isDynamicNgraphNode(op)) {
+            if (one_of(op->get_type_info(),
+                    ngraph::op::v3::GRUCell::get_type_info_static(),
+                    ngraph::op::v0::LSTMCell::get_type_info_static(),
+                    ngraph::op::v4::LSTMCell::get_type_info_static(),
+                    ngraph::op::v0::RNNCell::get_type_info_static())) {
+                errorMessage = "Doesn't support cells with dynamic shapes";
+                return false;
+            }
+            // the batch and the sequence length may be dynamic, the weights are packed for the static input size
+            const auto& dataShape = op->get_input_partial_shape(0);
+            if (dataShape.rank().is_dynamic() || dataShape.rank().get_length() != 3 || dataShape[2].is_dynamic()) {
+                errorMessage = "Doesn't support 'X' input with dynamic rank or input size";
+                return false;
+            }
+        }
+
         if (one_of(op->get_type_info(), ngraph::op::v0::RNNCell::get_type_info_static(), ngraph::op::v3::GRUCell::get_type_info_static())) {
             if (op->get_input_size() != 5) {
                 errorMessage = "Node expects 5 inputs. Actual: " + std::to_string(op->get_input_size());
@@ -356,13 +381,16 @@ void MKLDNNRNN::initSeq(const std::shared_ptr<ngraph::Node>& op) {
     if (!one_of(op->get_output_size(), 2, 3))
         IE_THROW() << "Incorrect number of output ports for layer " << getName();
 
-    in_data_dims = op->get_input_shape(0);
-    out_data_dims = op->get_output_shape(0);
+    in_data_dims = Shape(op->get_input_partial_shape(0)).getDims();
+    out_data_dims = Shape(op->get_output_partial_shape(0)).getDims();
 
     if (in_data_dims.size() != 3 || out_data_dims.size() != 4)
         IE_THROW() << "Incorrect shape of input/output ports for layer " << getName();
 
-    N = op->get_input_shape(1)[0];
+    N = Shape(op->get_input_partial_shape(1)).getDims()[0];
+    if (N == Shape::UNDEFINED_DIM)
+        N = in_data_dims[0];
+    in_data_dims[0] = out_data_dims[0] = N;
     nativeOrder = false;
     const auto rtInfo = op->get_rt_info();
 
@@ -378,6 +406,8 @@ void MKLDNNRNN::initSeq(const std::shared_ptr<ngraph::Node>& op) {
     S = statesCount(cell_type);
     T = in_data_dims[0];
     DC = in_data_dims[2];
+    shortSeqLengthsPossible = T == Shape::UNDEFINED_DIM ||
+                              ngraph::op::util::is_seq_len_provided(op->get_input_node_shared_ptr(wIdx - 1), static_cast<int64_t>(T));
     SC = rnnCellBase->get_hidden_size();
 
     Gb = (cell_type != mkldnn::algorithm::lbr_gru) ? G : G + 1;
@@ -391,11 +421,13 @@ void MKLDNNRNN::fillSeqDesc() {
     runtimePrecision = getOriginalInputPrecisionAtPort(0);
     auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
 
-    Shape S_4D_shape(VectorDims{L, D, N, SC});
+    // the descriptor defines the weights layout only, which doesn't depend on the batch and the sequence length,
+    // so the dummy values are used for the dynamic ones
+    Shape S_4D_shape = MemoryDescUtils::makeDummyShape(makeShape(VectorDims{L, D, N, SC}));
 
     // Try to create descriptor and corresponding configuration
-    in_data_d.emplace_back(Shape(VectorDims{in_data_dims}),  dataType, memory::format_tag::tnc);
-    out_data_d.emplace_back(Shape(VectorDims{out_data_dims}), dataType, memory::format_tag::tnc);
+    in_data_d.emplace_back(MemoryDescUtils::makeDummyShape(makeShape(in_data_dims)),  dataType, memory::format_tag::tnc);
+    out_data_d.emplace_back(MemoryDescUtils::makeDummyShape(makeShape(out_data_dims)), dataType, memory::format_tag::tnc);
 
     in_data_d.emplace_back(S_4D_shape, dataType, memory::format_tag::ldnc);
     out_data_d.emplace_back(S_4D_shape, dataType, memory::format_tag::ldnc);
@@ -414,26 +446,26 @@ void MKLDNNRNN::fillSeqDesc() {
         in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(inputShapes[RNNInOutKind::Layer], dataType, memory::format_tag::tnc));
     else if (N == 1)
         // WA to avoid reorder before sequence for some models
-        in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, T, DC}), dataType, memory::format_tag::tnc));
+        in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(makeShape(VectorDims{N, T, DC}), dataType, memory::format_tag::tnc));
     else
-        in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, T, DC}), dataType, memory::format_tag::ntc));
+        in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(makeShape(VectorDims{N, T, DC}), dataType, memory::format_tag::ntc));
 
     // initial hidden state
     // WA to avoid reorder before
     if (D == 1)
-        in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, D, SC}), dataType, memory::format_tag::tnc));
+        in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(makeShape(VectorDims{N, D, SC}), dataType, memory::format_tag::tnc));
     else
-        in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, D, SC}), dataType, memory::format_tag::ntc));
+        in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(makeShape(VectorDims{N, D, SC}), dataType, memory::format_tag::ntc));
 
     // initial cell state
     if (haveCellState(cell_type)) {
         if (D == 1)
-            in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, D, SC}), memory::data_type::f32, memory::format_tag::tnc));
+            in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(makeShape(VectorDims{N, D, SC}), memory::data_type::f32, memory::format_tag::tnc));
         else
-            in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, D, SC}), memory::data_type::f32, memory::format_tag::ntc));
+            in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(makeShape(VectorDims{N, D, SC}), memory::data_type::f32, memory::format_tag::ntc));
     }
 
-    in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N}), memory::data_type::s32, memory::format_tag::x)); // sequence lengths
+    in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(makeShape(VectorDims{N}), memory::data_type::s32, memory::format_tag::x)); // sequence lengths
     in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{D, G * SC, DC}), memory::data_type::f32, memory::format_tag::ntc)); // W
     in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{D, G * SC, SC}), memory::data_type::f32, memory::format_tag::ntc)); // R
     in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{D, Gb * SC}), memory::data_type::f32, memory::format_tag::nc)); // B
@@ -445,22 +477,22 @@ void MKLDNNRNN::fillSeqDesc() {
         out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(out_data_d[RNNInOutKind::Layer]));
     } else if (N == 1) {
         // WA to avoid reorder after sequence for some models
-        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, T, SC}), dataType, memory::format_tag::tnc));
+        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(makeShape(VectorDims{N, T, SC}), dataType, memory::format_tag::tnc));
     } else {
-        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, T, SC}), dataType, memory::format_tag::ntc));
+        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(makeShape(VectorDims{N, T, SC}), dataType, memory::format_tag::ntc));
     }
 
     // WA to avoid reorder after
     if (D == 1)
-        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, D, SC}), dataType, memory::format_tag::tnc));
+        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(makeShape(VectorDims{N, D, SC}), dataType, memory::format_tag::tnc));
     else
-        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, D, SC}), dataType, memory::format_tag::ntc));
+        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(makeShape(VectorDims{N, D, SC}), dataType, memory::format_tag::ntc));
 
     if (haveCellState(cell_type)) {
         if (D == 1)
-            out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, D, SC}), memory::data_type::f32, memory::format_tag::tnc));
+            out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(makeShape(VectorDims{N, D, SC}), memory::data_type::f32, memory::format_tag::tnc));
         else
-            out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, D, SC}), memory::data_type::f32, memory::format_tag::ntc));
+            out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(makeShape(VectorDims{N, D, SC}), memory::data_type::f32, memory::format_tag::ntc));
     }
 
     createDescriptor(in_candidate, out_candidate);
@@ -624,6 +656,11 @@ void MKLDNNRNN::copyWeightsData() {
         }
     }
 
+    // the weights are shared by the primitives created for the different batch and sequence lengths, which are used by
+    // the dynamic node and for the sequence lengths shorter than the sequence
+    if (isDynamicNode() || shortSeqLengthsPossible)
+        w_format = mkldnn::memory::format_tag::ldigo;
+
     if (runtimePrecision == Precision::BF16) {
         fillWeights<uint16_t>(gate_map, wIdx, rIdx);
     } else if (runtimePrecision == Precision::FP32) {
@@ -648,98 +685,210 @@ void MKLDNNRNN::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
     auto biasDims = MKLDNNExtensionUtils::convertToDnnlDims(VectorDims{ L, D, Gb, SC });
     mkldnn::memory::desc w_bias_d(biasDims, memory::data_type::f32, memory::format_tag::ldgo);
 
+    std::vector<mkldnn::memory::desc> inDataDescs, outDataDescs;
+    for (const auto& desc : in_data_d)
+        inDataDescs.push_back(desc.getDnnlDesc());
+    for (const auto& desc : out_data_d)
+        outDataDescs.push_back(desc.getDnnlDesc());
+    descs.push_back(createRnnDescriptor(inDataDescs, outDataDescs, w_data_d, w_state_d, w_bias_d));
+
+    // Fill supported config
+    NodeConfig config;
+    config.dynBatchSupport = false;
+    for (size_t i = 0; i < inputDesc.size(); i++) {
+        PortConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = inputDesc[i];
+        config.inConfs.push_back(dataConfig);
+    }
+
+    for (size_t i = 0; i < outputDesc.size(); i++) {
+        PortConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = outputDesc[i];
+        config.outConfs.push_back(dataConfig);
+    }
+
+    supportedPrimitiveDescriptors.emplace_back(config, ref_any);
+}
+
+MKLDNNDescriptor MKLDNNRNN::createRnnDescriptor(const std::vector<mkldnn::memory::desc>& inDataDescs,
+                                                const std::vector<mkldnn::memory::desc>& outDataDescs,
+                                                const mkldnn::memory::desc& w_data_d,
+                                                const mkldnn::memory::desc& w_state_d,
+                                                const mkldnn::memory::desc& w_bias_d) const {
     switch (cell_type) {
-        case mkldnn::algorithm::vanilla_rnn: {
-            MKLDNNDescriptor desc(std::shared_ptr<vanilla_rnn_forward::desc>(
+        case mkldnn::algorithm::vanilla_rnn:
+            return MKLDNNDescriptor(std::shared_ptr<vanilla_rnn_forward::desc>(
                     new vanilla_rnn_forward::desc(prop_kind::forward_scoring, cell_act, direction,
-                            /* In Data       */ in_data_d[RNNInOutKind::Layer].getDnnlDesc(),
-                            /* In State      */ in_data_d[RNNInOutKind::HiddenState].getDnnlDesc(),
+                            /* In Data       */ inDataDescs[RNNInOutKind::Layer],
+                            /* In State      */ inDataDescs[RNNInOutKind::HiddenState],
                             /* Weights data  */ w_data_d,
                             /* Weights state */ w_state_d,
                             /* Bias          */ w_bias_d,
-                            /* Out Data      */ out_data_d[RNNInOutKind::Layer].getDnnlDesc(),
-                            /* Out State     */ out_data_d[RNNInOutKind::HiddenState].getDnnlDesc())));
-            descs.push_back(desc);
-        } break;
-        case mkldnn::algorithm::vanilla_gru: {
-            MKLDNNDescriptor desc(std::shared_ptr<gru_forward::desc>(
+                            /* Out Data      */ outDataDescs[RNNInOutKind::Layer],
+                            /* Out State     */ outDataDescs[RNNInOutKind::HiddenState])));
+        case mkldnn::algorithm::vanilla_gru:
+            return MKLDNNDescriptor(std::shared_ptr<gru_forward::desc>(
                     new gru_forward::desc(prop_kind::forward_scoring, direction,
-                            /* In Data       */ in_data_d[RNNInOutKind::Layer].getDnnlDesc(),
-                            /* In State      */ in_data_d[RNNInOutKind::HiddenState].getDnnlDesc(),
+                            /* In Data       */ inDataDescs[RNNInOutKind::Layer],
+                            /* In State      */ inDataDescs[RNNInOutKind::HiddenState],
                             /* Weights data  */ w_data_d,
                             /* Weights state */ w_state_d,
                             /* Bias          */ w_bias_d,
-                            /* Out Data      */ out_data_d[RNNInOutKind::Layer].getDnnlDesc(),
-                            /* Out State     */ out_data_d[RNNInOutKind::HiddenState].getDnnlDesc())));
-            descs.push_back(desc);
-        } break;
-        case mkldnn::algorithm::lbr_gru: {
-            MKLDNNDescriptor desc(std::shared_ptr<lbr_gru_forward::desc>(
+                            /* Out Data      */ outDataDescs[RNNInOutKind::Layer],
+                            /* Out State     */ outDataDescs[RNNInOutKind::HiddenState])));
+        case mkldnn::algorithm::lbr_gru:
+            return MKLDNNDescriptor(std::shared_ptr<lbr_gru_forward::desc>(
                     new lbr_gru_forward::desc(prop_kind::forward_scoring, direction,
-                            /* In Data       */ in_data_d[RNNInOutKind::Layer].getDnnlDesc(),
-                            /* In State      */ in_data_d[RNNInOutKind::HiddenState].getDnnlDesc(),
+                            /* In Data       */ inDataDescs[RNNInOutKind::Layer],
+                            /* In State      */ inDataDescs[RNNInOutKind::HiddenState],
                             /* Weights data  */ w_data_d,
                             /* Weights state */ w_state_d,
                             /* Bias          */ w_bias_d,
-                            /* Out Data      */ out_data_d[RNNInOutKind::Layer].getDnnlDesc(),
-                            /* Out State     */ out_data_d[RNNInOutKind::HiddenState].getDnnlDesc())));
-            descs.push_back(desc);
-        } break;
-        case mkldnn::algorithm::vanilla_lstm: {
-            MKLDNNDescriptor desc(std::shared_ptr<lstm_forward::desc>(
+                            /* Out Data      */ outDataDescs[RNNInOutKind::Layer],
+                            /* Out State     */ outDataDescs[RNNInOutKind::HiddenState])));
+        case mkldnn::algorithm::vanilla_lstm:
+            return MKLDNNDescriptor(std::shared_ptr<lstm_forward::desc>(
                     new lstm_forward::desc(prop_kind::forward_scoring, direction,
-                            /* In Data       */ in_data_d[RNNInOutKind::Layer].getDnnlDesc(),
-                            /* In State      */ in_data_d[RNNInOutKind::HiddenState].getDnnlDesc(),
-                            /* In State C    */ in_data_d[RNNInOutKind::CellState].getDnnlDesc(),
+                            /* In Data       */ inDataDescs[RNNInOutKind::Layer],
+                            /* In State      */ inDataDescs[RNNInOutKind::HiddenState],
+                            /* In State C    */ inDataDescs[RNNInOutKind::CellState],
                             /* Weights data  */ w_data_d,
                             /* Weights state */ w_state_d,
                             /* Bias          */ w_bias_d,
-                            /* Out Data      */ out_data_d[RNNInOutKind::Layer].getDnnlDesc(),
-                            /* Out State     */ out_data_d[RNNInOutKind::HiddenState].getDnnlDesc(),
-                            /* Out State C   */ out_data_d[RNNInOutKind::CellState].getDnnlDesc())));
-            descs.push_back(desc);
-        } break;
+                            /* Out Data      */ outDataDescs[RNNInOutKind::Layer],
+                            /* Out State     */ outDataDescs[RNNInOutKind::HiddenState],
+                            /* Out State C   */ outDataDescs[RNNInOutKind::CellState])));
         default:
             IE_THROW() << "Unknown cell type";
     }
+}
 
-    // Fill supported config
-    NodeConfig config;
-    config.dynBatchSupport = false;
-    for (size_t i = 0; i < inputDesc.size(); i++) {
-        PortConfig dataConfig;
-        dataConfig.inPlace = -1;
-        dataConfig.constant = false;
-        dataConfig.desc = inputDesc[i];
-        config.inConfs.push_back(dataConfig);
+void MKLDNNRNN::createPrimitive() {
+    if (inputShapesDefined()) {
+        if (needPrepareParams())
+            prepareParams();
+        updateLastInputDims();
     }
+}
 
-    for (size_t i = 0; i < outputDesc.size(); i++) {
-        PortConfig dataConfig;
-        dataConfig.inPlace = -1;
-        dataConfig.constant = false;
-        dataConfig.desc = outputDesc[i];
-        config.outConfs.push_back(dataConfig);
+void MKLDNNRNN::prepareParams() {
+    const auto& dataDims = getParentEdgesAtPort(0)[0]->getMemory().getStaticDims();
+    if (is_cell) {
+        N = dataDims[0];
+    } else if (nativeOrder) {
+        T = dataDims[0];
+        N = dataDims[1];
+    } else {
+        N = dataDims[0];
+        T = dataDims[1];
     }
 
-    supportedPrimitiveDescriptors.emplace_back(config, ref_any);
+    if (!isDynamicNode()) {
+        // the whole sequence is processed by the single primitive created for the compile time shapes
+        if (cell_type == mkldnn::algorithm::vanilla_rnn) {
+            auto prim_desc = createPrimitiveDescriptor<vanilla_rnn_forward::primitive_desc, vanilla_rnn_forward::desc>();
+            prim.reset(new vanilla_rnn_forward(prim_desc));
+        } else if (cell_type == mkldnn::algorithm::vanilla_gru) {
+            auto prim_desc = createPrimitiveDescriptor<gru_forward::primitive_desc, gru_forward::desc>();
+            prim.reset(new gru_forward(prim_desc));
+        } else if (cell_type == mkldnn::algorithm::lbr_gru) {
+            auto prim_desc = createPrimitiveDescriptor<lbr_gru_forward::primitive_desc, lbr_gru_forward::desc>();
+            prim.reset(new lbr_gru_forward(prim_desc));
+        } else if (cell_type == mkldnn::algorithm::vanilla_lstm) {
+            auto prim_desc = createPrimitiveDescriptor<lstm_forward::primitive_desc, lstm_forward::desc>();
+            prim.reset(new lstm_forward(prim_desc));
+        } else {
+            IE_THROW() << "Unknown cell type";
+        }
+    } else if (internalBlobMemory.empty()) {
+        // the weights are packed once, the plain layout doesn't depend on the batch and the sequence length
+        auto itpd = descs[0].createPrimitiveDescriptorIterator(getEngine());
+        prepareMemory(getSelectedPrimitiveDescriptor(), itpd);
+    }
+
+    fullPlan.clear();
+    appendChunks(0, T, fullPlan);
+
+    if (!is_cell) {
+        const auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
+        const auto statesDims = MKLDNNExtensionUtils::convertToDnnlDims(VectorDims{L, D, N, SC});
+        for (auto& states : scratchStates) {
+            states.clear();
+            for (size_t s = 0; s < S; s++) {
+                // the cell state is always f32
+                const auto stateType = s == 0 ? dataType : memory::data_type::f32;
+                states.emplace_back(mkldnn::memory::desc(statesDims, stateType, memory::format_tag::ldnc), getEngine());
+            }
+        }
+    }
 }
 
-void MKLDNNRNN::createPrimitive() {
-    if (cell_type == mkldnn::algorithm::vanilla_rnn) {
-        auto prim_desc = createPrimitiveDescriptor<vanilla_rnn_forward::primitive_desc, vanilla_rnn_forward::desc>();
-        prim.reset(new vanilla_rnn_forward(prim_desc));
-    } else if (cell_type == mkldnn::algorithm::vanilla_gru) {
-        auto prim_desc = createPrimitiveDescriptor<gru_forward::primitive_desc, gru_forward::desc>();
-        prim.reset(new gru_forward(prim_desc));
-    } else if (cell_type == mkldnn::algorithm::lbr_gru) {
-        auto prim_desc = createPrimitiveDescriptor<lbr_gru_forward::primitive_desc, lbr_gru_forward::desc>();
-        prim.reset(new lbr_gru_forward(prim_desc));
-    } else if (cell_type == mkldnn::algorithm::vanilla_lstm) {
-        auto prim_desc = createPrimitiveDescriptor<lstm_forward::primitive_desc, lstm_forward::desc>();
-        prim.reset(new lstm_forward(prim_desc));
-    } else {
-        IE_THROW() << "Unknown cell type";
+std::shared_ptr<mkldnn::primitive> MKLDNNRNN::getChunkPrimitive(size_t length) {
+    // the key doesn't contain the whole sequence length, so the chunk primitives are shared by all the lengths
+    PrimitiveCacheKey key;
+    key.inputDims = {{N, length}};
+    return primitivesCache.getOrCreate(key, [&](const PrimitiveCacheKey&) -> std::shared_ptr<mkldnn::primitive> {
+        const auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
+        const auto statesDims = MKLDNNExtensionUtils::convertToDnnlDims(VectorDims{L, D, N, SC});
+
+        std::vector<mkldnn::memory::desc> inDataDescs {
+            {MKLDNNExtensionUtils::convertToDnnlDims(VectorDims{length, N, DC}), dataType, memory::format_tag::tnc},
+            {statesDims, dataType, memory::format_tag::ldnc}
+        };
+        std::vector<mkldnn::memory::desc> outDataDescs {
+            {MKLDNNExtensionUtils::convertToDnnlDims(VectorDims{length, N, SC}), dataType, memory::format_tag::tnc},
+            {statesDims, dataType, memory::format_tag::ldnc}
+        };
+        if (haveCellState(cell_type)) {
+            inDataDescs.emplace_back(statesDims, memory::data_type::f32, memory::format_tag::ldnc);
+            outDataDescs.emplace_back(statesDims, memory::data_type::f32, memory::format_tag::ldnc);
+        }
+
+        auto desc = createRnnDescriptor(inDataDescs, outDataDescs,
+                                        internalBlobMemory[0]->GetPrimitive().get_desc(),
+                                        internalBlobMemory[1]->GetPrimitive().get_desc(),
+                                        internalBlobMemory[2]->GetPrimitive().get_desc());
+        auto itpd = desc.createPrimitiveDescriptorIterator(getEngine());
+        if (!static_cast<bool>(itpd))
+            IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
+
+        switch (cell_type) {
+            case mkldnn::algorithm::vanilla_rnn:
+                return std::make_shared<vanilla_rnn_forward>(vanilla_rnn_forward::primitive_desc(itpd.get()));
+            case mkldnn::algorithm::vanilla_gru:
+                return std::make_shared<gru_forward>(gru_forward::primitive_desc(itpd.get()));
+            case mkldnn::algorithm::lbr_gru:
+                return std::make_shared<lbr_gru_forward>(lbr_gru_forward::primitive_desc(itpd.get()));
+            case mkldnn::algorithm::vanilla_lstm:
+                return std::make_shared<lstm_forward>(lstm_forward::primitive_desc(itpd.get()));
+            default:
+                IE_THROW() << "Unknown cell type";
+        }
+    });
+}
+
+void MKLDNNRNN::appendChunks(size_t begin, size_t end, std::vector<SeqChunk>& chunks) {
+    if (prim && begin == 0 && end == T) {
+        chunks.push_back({0, T, prim});
+        return;
+    }
+    // the backward part of the bidirectional sequence must start from the end of the whole range, so it is not split
+    if (direction == mkldnn::rnn_direction::bidirectional_concat) {
+        chunks.push_back({begin, end - begin, getChunkPrimitive(end - begin)});
+        return;
+    }
+    // the sequence is split into the chunks of power of two lengths, so there are at most log2(T) primitives
+    // per batch size whatever the sequence length is
+    while (begin < end) {
+        size_t length = 1;
+        while (length * 2 <= end - begin)
+            length *= 2;
+        chunks.push_back({begin, length, getChunkPrimitive(length)});
+        begin += length;
     }
 }
 
@@ -753,10 +902,8 @@ std::shared_ptr<MemoryDesc> MKLDNNRNN::getDstMemDesc(mkldnn::primitive_desc_iter
     return desc->as<BlockedMemoryDesc>()->cloneWithUndefStridesAndOffset();
 }
 
-void MKLDNNRNN::execute(mkldnn::stream strm) {
-    if (!prim)
-        IE_THROW() << "No initialized primitive to execute";
-
+void MKLDNNRNN::executeChunk(mkldnn::stream strm, const SeqChunk& chunk,
+                             const std::vector<mkldnn::memory>& srcStates, const std::vector<mkldnn::memory>& dstStates) {
     const auto src_data_mem = getParentEdgeAt(0)->getMemoryPtr();
     const auto dst_data_mem = getChildEdgeAt(0)->getMemoryPtr();
 
@@ -765,33 +912,150 @@ void MKLDNNRNN::execute(mkldnn::stream strm) {
     const auto &wgh_bias_mem = internalBlobMemory[2];
 
     std::unordered_map<int, memory> args {
-        {DNNL_ARG_SRC_LAYER,     src_data_mem->GetPrimitive()},
         {DNNL_ARG_WEIGHTS_LAYER, wgh_data_mem->GetPrimitive()},
         {DNNL_ARG_WEIGHTS_ITER,  wgh_stat_mem->GetPrimitive()},
         {DNNL_ARG_BIAS,          wgh_bias_mem->GetPrimitive()},
-        {DNNL_ARG_DST_LAYER,     dst_data_mem->GetPrimitive()},
     };
 
+    if (chunk.length == T) {
+        args[DNNL_ARG_SRC_LAYER] = src_data_mem->GetPrimitive();
+        args[DNNL_ARG_DST_LAYER] = dst_data_mem->GetPrimitive();
+    } else {
+        // the data is time major, so the chunk is a contiguous part of the sequence
+        const auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
+        const size_t elemSize = runtimePrecision.size();
+        auto src = static_cast<uint8_t*>(src_data_mem->GetPtr()) + chunk.begin * N * DC * elemSize;
+        auto dst = static_cast<uint8_t*>(dst_data_mem->GetPtr()) + chunk.begin * N * SC * elemSize;
+        args[DNNL_ARG_SRC_LAYER] = mkldnn::memory({MKLDNNExtensionUtils::convertToDnnlDims(VectorDims{chunk.length, N, DC}),
+                                                   dataType, memory::format_tag::tnc}, getEngine(), src);
+        args[DNNL_ARG_DST_LAYER] = mkldnn::memory({MKLDNNExtensionUtils::convertToDnnlDims(VectorDims{chunk.length, N, SC}),
+                                                   dataType, memory::format_tag::tnc}, getEngine(), dst);
+    }
+
     int state_i_tags[] {DNNL_ARG_SRC_ITER, DNNL_ARG_SRC_ITER_C};
     int state_o_tags[] {DNNL_ARG_DST_ITER, DNNL_ARG_DST_ITER_C};
+    for (size_t s = 0; s < srcStates.size(); s++)
+        args[state_i_tags[s]] = srcStates[s];
+    for (size_t s = 0; s < dstStates.size(); s++)
+        args[state_o_tags[s]] = dstStates[s];
+
+    (*chunk.prim).execute(strm, args);
+}
+
+void MKLDNNRNN::executeWithSeqLengths(mkldnn::stream strm, const int32_t* seqLengths,
+                                      const std::vector<mkldnn::memory>& srcStates, const std::vector<mkldnn::memory>& dstStates) {
+    auto seqLength = [&](size_t b) {
+        return static_cast<size_t>(std::min<int64_t>(std::max<int32_t>(seqLengths[b], 0), T));
+    };
+    const size_t elemSize = runtimePrecision.size();
+    auto copyStateRow = [&](const mkldnn::memory& from, size_t s, size_t b) {
+        const size_t rowSize = SC * (s == 0 ? elemSize : sizeof(float));
+        cpu_memcpy(static_cast<uint8_t*>(dstStates[s].get_data_handle()) + b * rowSize,
+                   static_cast<uint8_t*>(from.get_data_handle()) + b * rowSize, rowSize);
+    };
+
+    std::vector<size_t> ends;
+    for (size_t b = 0; b < N; b++) {
+        const size_t length = seqLength(b);
+        if (length == 0) {
+            for (size_t s = 0; s < dstStates.size(); s++)
+                copyStateRow(srcStates[s], s, b);
+        } else {
+            ends.push_back(length);
+        }
+    }
+    std::sort(ends.begin(), ends.end());
+    ends.erase(std::unique(ends.begin(), ends.end()), ends.end());
+
+    // the whole batch is processed up to the end of each sequence, after that the final states of the sequences
+    // ended there are taken from the intermediate states
+    const std::vector<mkldnn::memory>* states = &srcStates;
+    size_t begin = 0, chunkIdx = 0;
+    std::vector<SeqChunk> chunks;
+    for (const auto end : ends) {
+        chunks.clear();
+        appendChunks(begin, end, chunks);
+        for (const auto& chunk : chunks) {
+            const auto& dst = scratchStates[chunkIdx++ % 2];
+            executeChunk(strm, chunk, *states, dst);
+            states = &dst;
+        }
+        for (size_t b = 0; b < N; b++) {
+            if (seqLength(b) == end) {
+                for (size_t s = 0; s < dstStates.size(); s++)
+                    copyStateRow((*states)[s], s, b);
+            }
+        }
+        begin = end;
+    }
+
+    // the outputs past the end of the sequence are zeros
+    auto dst = static_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const size_t rowSize = SC * elemSize;
+    parallel_for2d(T, N, [&](size_t t, size_t b) {
+        if (t >= seqLength(b))
+            memset(dst + (t * N + b) * rowSize, 0, rowSize);
+    });
+}
+
+void MKLDNNRNN::execute(mkldnn::stream strm) {
+    if (N == 0)
+        return;
+
+    std::vector<mkldnn::memory> srcStates, dstStates;
     for (size_t s = 0; s < S; s++) {
-        args[state_i_tags[s]] = getParentEdgeAt(s+1)->getMemoryPtr()->GetPrimitive();
+        srcStates.push_back(getParentEdgeAt(s+1)->getMemoryPtr()->GetPrimitive());
     }
 
     if (is_cell) {
         for (size_t s = 0; s < S; s++) {
-            args[state_o_tags[s]] = getChildEdgesAtPort(s)[0]->getMemoryPtr()->GetPrimitive();
+            dstStates.push_back(getChildEdgesAtPort(s)[0]->getMemoryPtr()->GetPrimitive());
         }
     } else {
         size_t n_ports_with_init_states = outputShapes.size() - 1; // first is a sequence data
         for (size_t s = 0; s < std::min(S, n_ports_with_init_states); s++) {
-            if (s < outputShapes.size()) {
-                args[state_o_tags[s]] = getChildEdgesAtPort(s+1)[0]->getMemoryPtr()->GetPrimitive();
-            }
+            dstStates.push_back(getChildEdgesAtPort(s+1)[0]->getMemoryPtr()->GetPrimitive());
+        }
+
+        // an empty sequence leaves the initial states as they are, as the sequences of zero length do
+        if (T == 0) {
+            for (size_t s = 0; s < dstStates.size(); s++)
+                cpu_memcpy(dstStates[s].get_data_handle(), srcStates[s].get_data_handle(), dstStates[s].get_desc().get_size());
+            return;
+        }
+
+        const auto seqLengths = reinterpret_cast<const int32_t*>(getParentEdgeAt(wIdx - 1)->getMemoryPtr()->GetPtr());
+        if (std::any_of(seqLengths, seqLengths + N, [&](int32_t length) { return length < static_cast<int64_t>(T); })) {
+            if (direction != mkldnn::rnn_direction::unidirectional_left2right)
+                IE_THROW() << "Node " << getName() << " supports the sequence lengths shorter than the sequence only for the forward direction";
+            executeWithSeqLengths(strm, seqLengths, srcStates, dstStates);
+            return;
         }
     }
 
-    (*prim).execute(strm, args);
+    if (fullPlan.empty())
+        IE_THROW() << "No initialized primitive to execute";
+
+    // the states are passed between the chunks through the scratch memory, the reverse sequence starts from the last chunk
+    const bool reverse = direction == mkldnn::rnn_direction::unidirectional_right2left;
+    for (size_t i = 0; i < fullPlan.size(); i++) {
+        const auto& chunk = fullPlan[reverse ? fullPlan.size() - 1 - i : i];
+        const auto& src = i == 0 ? srcStates : scratchStates[(i - 1) % 2];
+        const auto& dst = i == fullPlan.size() - 1 ? dstStates : scratchStates[i % 2];
+        executeChunk(strm, chunk, src, dst);
+    }
+}
+
+void MKLDNNRNN::executeDynamicImpl(mkldnn::stream strm) {
+    execute(strm);
+}
+
+std::vector<VectorDims> MKLDNNRNN::shapeInfer() const {
+    auto result = MKLDNNNode::shapeInfer();
+    // the num_directions axis of the sequence output may be removed by the graph optimizer (see reshapeRnnSeq)
+    if (!is_cell && outputShapes[0].getRank() == 3 && result[0].size() == 4)
+        result[0].erase(result[0].begin() + 1);
+    return result;
 }
 
 }  // namespace MKLDNNPlugin
@@ -26,6 +26,9 @@ public:
                           const std::vector<MemoryDescPtr>& outputDesc) override;
 
     void execute(mkldnn::stream strm) override;
+    void executeDynamicImpl(mkldnn::stream strm) override;
+    void prepareParams() override;
+    std::vector<VectorDims> shapeInfer() const override;
 
     inline bool hasNativeOrder() const {
         return nativeOrder;
@@ -46,6 +49,26 @@ private:
 
     void copyWeightsData();
 
+    MKLDNNDescriptor createRnnDescriptor(const std::vector<mkldnn::memory::desc>& inDataDescs,
+                                         const std::vector<mkldnn::memory::desc>& outDataDescs,
+                                         const mkldnn::memory::desc& w_data_d,
+                                         const mkldnn::memory::desc& w_state_d,
+                                         const mkldnn::memory::desc& w_bias_d) const;
+
+    /** Part of the sequence [begin, begin + length) processed by one primitive */
+    struct SeqChunk {
+        size_t begin;
+        size_t length;
+        std::shared_ptr<mkldnn::primitive> prim;
+    };
+
+    std::shared_ptr<mkldnn::primitive> getChunkPrimitive(size_t length);
+    void appendChunks(size_t begin, size_t end, std::vector<SeqChunk>& chunks);
+    void executeChunk(mkldnn::stream strm, const SeqChunk& chunk,
+                      const std::vector<mkldnn::memory>& srcStates, const std::vector<mkldnn::memory>& dstStates);
+    void executeWithSeqLengths(mkldnn::stream strm, const int32_t* seqLengths,
+                               const std::vector<mkldnn::memory>& srcStates, const std::vector<mkldnn::memory>& dstStates);
+
 private:
     InferenceEngine::Precision runtimePrecision;
     /** Specify mode Cell or Seq. true - Cell, false - Seq */
@@ -63,6 +86,9 @@ private:
     /** activation type for vanilla RNN cell */
     mkldnn::algorithm cell_act = mkldnn::algorithm::eltwise_tanh;
 
+    /** The sequence_lengths input may contain the lengths shorter than the sequence, so the chunks may be executed */
+    bool shortSeqLengthsPossible = false;
+
     /** Weights data and state memory format: ldigo or any */
     mkldnn::memory::format_tag w_format = mkldnn::memory::format_tag::any;
 
@@ -93,6 +119,11 @@ private:
     size_t rIdx = 0;
     size_t bIdx = 0;
 
+    /** Chunks processing the whole sequence of the current length */
+    std::vector<SeqChunk> fullPlan;
+    /** States passed between the chunks, two sets to not read and write the same memory */
+    std::vector<mkldnn::memory> scratchStates[2];
+
     static const std::map<InferenceEngine::Precision, InferenceEngine::Precision> weightsByLayerPrec;
 };
 
@@ -21,10 +21,6 @@ using namespace InferenceEngine;
 
 bool MKLDNNRollNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
         const auto interp = std::dynamic_pointer_cast<const ngraph::opset7::Roll>(op);
         if (!interp) {
             errorMessage = "Only opset7 Roll operation is supported";
@@ -45,18 +41,17 @@ MKLDNNRollNode::MKLDNNRollNode(const std::shared_ptr<ngraph::Node>& op, const mk
             IE_THROW() << layerErrorPrefix << " has incorrect number of input/output edges!";
         }
 
-        shape = inputShapes[DATA_INDEX].getStaticDims();
         const auto &dataPrecision = getOriginalInputPrecisionAtPort(DATA_INDEX);
 
         if (std::find(supportedPrecisionSizes.begin(), supportedPrecisionSizes.end(), dataPrecision.size()) == supportedPrecisionSizes.end())
             IE_THROW() << layerErrorPrefix << "has unsupported precision: " << dataPrecision.name();
 
-        if (shape.size() < 1) {
-            IE_THROW() << layerErrorPrefix << " doesn't support 'data' input tensor with rank: " << shape.size();
+        numOfDims = inputShapes[DATA_INDEX].getRank();
+        if (numOfDims < 1) {
+            IE_THROW() << layerErrorPrefix << " doesn't support 'data' input tensor with rank: " << numOfDims;
         }
-        numOfDims = shape.size();
 
-        if (shape != outputShapes[0].getStaticDims()) {
+        if (inputShapes[DATA_INDEX].getDims() != outputShapes[0].getDims()) {
             IE_THROW() << layerErrorPrefix << " has different 'data' input and output dimensions";
         }
 
@@ -94,8 +89,6 @@ void MKLDNNRollNode::initSupportedPrimitiveDescriptors() {
 
     InferenceEngine::Precision precision = getOriginalInputPrecisionAtPort(0);
 
-    auto srcDims = getInputShapeAtPort(0).getStaticDims();
-
     addSupportedPrimDesc({{LayoutType::ncsp, precision},
                           {LayoutType::ncsp, InferenceEngine::Precision::I32},
                           {LayoutType::ncsp, InferenceEngine::Precision::I32}},
@@ -103,6 +96,24 @@ void MKLDNNRollNode::initSupportedPrimitiveDescriptors() {
                          impl_desc_type::ref);
 }
 
+void MKLDNNRollNode::prepareParams() {
+    const auto& dataMemPtr = getParentEdgeAt(DATA_INDEX)->getMemoryPtr();
+    if (!dataMemPtr || !dataMemPtr->GetPrimitivePtr())
+        IE_THROW() << layerErrorPrefix << " has not allocated input memory.";
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        IE_THROW() << layerErrorPrefix << " has unidentified preferable primitive descriptor.";
+
+    shape = dataMemPtr->getStaticDims();
+    strides = dataMemPtr->GetDescWithType<BlockedMemoryDesc>()->getStrides();
+}
+
+void MKLDNNRollNode::createPrimitive() {
+    if (inputShapesDefined()) {
+        if (needPrepareParams())
+            prepareParams();
+        updateLastInputDims();
+    }
+}
 
 void MKLDNNRollNode::execute(mkldnn::stream strm) {
     const auto dataPrecision = getParentEdgeAt(DATA_INDEX)->getMemory().getDesc().getPrecision();
@@ -149,17 +160,20 @@ void MKLDNNRollNode::rollImpl() {
         int32_t currentAxis = axes[dim] < 0 ? axes[dim] + numOfDims : axes[dim];
         int32_t shiftSum = shiftsVector[currentAxis] + shifts[dim];
         int32_t dimSize = shape[currentAxis];
+        if (dimSize == 0)
+            continue;
         shiftsVector[currentAxis] = (shiftSum % dimSize + dimSize) % dimSize;
     }
 
     const size_t blockSize = shape.back();
+    if (blockSize == 0)
+        return;
     const size_t totalElements = std::accumulate(shape.begin(), shape.end(), 1, std::multiplies<size_t>());
     const size_t leftBlockSize = blockSize - shiftsVector.back();
     const size_t rightBlockSize = blockSize - leftBlockSize;
     const size_t elementSize = sizeof(DataType);
 
     const size_t nIterations = totalElements / blockSize;
-    const auto strides = dataEdge->getMemory().GetDescWithType<BlockedMemoryDesc>()->getStrides();
     parallel_for(nIterations, [&](size_t iter) {
         size_t start = iter * blockSize;
         size_t leftBlockStartOffset = start;
@@ -183,12 +197,14 @@ void MKLDNNRollNode::rollImpl() {
     });
 }
 
+void MKLDNNRollNode::executeDynamicImpl(mkldnn::stream strm) {
+    execute(strm);
+}
+
 bool MKLDNNRollNode::created() const {
     return getType() == Roll;
 }
 
-void MKLDNNRollNode::createPrimitive() {}
-
 const std::vector<size_t> MKLDNNRollNode::supportedPrecisionSizes = {1, 2, 4};
 
 REG_MKLDNN_PRIM_FOR(MKLDNNRollNode, Roll)
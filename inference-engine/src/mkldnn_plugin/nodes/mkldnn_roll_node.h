@@ -22,6 +22,10 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+protected:
+    void executeDynamicImpl(mkldnn::stream strm) override;
+    void prepareParams() override;
+
 private:
     size_t calculateShiftOffset(size_t dataOffset, size_t dimShift, size_t segmentSize, size_t dimSize);
 
@@ -29,6 +33,7 @@ private:
     void rollImpl();
 
     std::vector<size_t> shape;
+    std::vector<size_t> strides;
     static const std::vector<size_t> supportedPrecisionSizes;
     std::string layerErrorPrefix;
     size_t numOfDims;
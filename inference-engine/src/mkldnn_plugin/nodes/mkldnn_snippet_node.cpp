@@ -0,0 +1,273 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_snippet_node.h"
+
+#include <ie_parallel.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/rt_info.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "emitters/cpu_generator.hpp"
+#include "utils/general_utils.h"
+#include "utils/ngraph_utils.hpp"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+bool MKLDNNSnippetNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto subgraph = std::dynamic_pointer_cast<const ngraph::snippets::op::Subgraph>(op);
+        if (!subgraph) {
+            errorMessage = "Only snippets Subgraph operation is supported";
+            return false;
+        }
+        if (isDynamicNgraphNode(op)) {
+            errorMessage = "Doesn't support op with dynamic shapes";
+            return false;
+        }
+        if (!mayiuse(avx2)) {
+            errorMessage = "Doesn't support platforms without avx2";
+            return false;
+        }
+        if (op->get_input_size() + op->get_output_size() > SNIPPETS_MAX_PTRS) {
+            errorMessage = "Doesn't support more than " + std::to_string(SNIPPETS_MAX_PTRS) + " inputs and outputs in total";
+            return false;
+        }
+
+        const auto& outShape = op->get_output_shape(0);
+        if (outShape.size() > rank6D) {
+            errorMessage = "Doesn't support tensors with rank more than " + std::to_string(rank6D);
+            return false;
+        }
+        for (const auto& output : op->outputs()) {
+            if (output.get_element_type() != ngraph::element::f32) {
+                errorMessage = "Supports only f32 outputs";
+                return false;
+            }
+            if (output.get_shape() != outShape) {
+                errorMessage = "Supports only outputs of the same shape";
+                return false;
+            }
+        }
+        for (const auto& input : op->inputs()) {
+            if (input.get_element_type() != ngraph::element::f32) {
+                errorMessage = "Supports only f32 inputs";
+                return false;
+            }
+            const auto& inShape = input.get_shape();
+            if (inShape.size() > outShape.size()) {
+                errorMessage = "Doesn't support inputs of higher rank than outputs";
+                return false;
+            }
+            // only numpy broadcasting of inputs to the output shape can be scheduled
+            const size_t offset = outShape.size() - inShape.size();
+            for (size_t i = 0; i < inShape.size(); i++) {
+                if (inShape[i] != outShape[i + offset] && inShape[i] != 1) {
+                    errorMessage = "Supports only numpy broadcasting of inputs to the output shape";
+                    return false;
+                }
+            }
+        }
+
+        // per-channel PRelu requires slopes to be loaded with the channel stride which is not supported by the generated kernel
+        for (const auto& node : subgraph->get_body()->get_ordered_ops()) {
+            if (const auto prelu = ngraph::as_type_ptr<ngraph::opset1::PRelu>(node)) {
+                if (ngraph::shape_size(prelu->get_input_shape(1)) != 1) {
+                    errorMessage = "Doesn't support PRelu with non scalar slope";
+                    return false;
+                }
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNSnippetNode::MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+    errorPrefix = "Subgraph node with name '" + getName() + "'";
+    host_isa = mayiuse(avx512_common) ? avx512_common : avx2;
+
+    // code generation modifies the body, so it's done on a copy to keep the original function intact
+    const auto original = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(op);
+    ngraph::OutputVector subgraphInputs;
+    for (const auto& input : original->input_values()) {
+        subgraphInputs.push_back(std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape()));
+    }
+    auto body = ngraph::clone_function(*original->get_body());
+    snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraphInputs, body);
+    ngraph::copy_runtime_info(original, snippet);
+    snippet->set_friendly_name(original->get_friendly_name());
+    snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
+}
+
+void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    std::vector<PortConfigurator> inConfs(getOriginalInputsNumber(), {LayoutType::ncsp, Precision::FP32});
+    std::vector<PortConfigurator> outConfs(getOriginalOutputsNumber(), {LayoutType::ncsp, Precision::FP32});
+
+    const impl_desc_type implType = host_isa == avx512_common ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+    addSupportedPrimDesc(inConfs, outConfs, implType);
+}
+
+void MKLDNNSnippetNode::createPrimitive() {
+    prepareSchedule();
+    generate();
+}
+
+bool MKLDNNSnippetNode::created() const {
+    return getType() == Subgraph;
+}
+
+void MKLDNNSnippetNode::prepareSchedule() {
+    auto extendTo6D = [](const VectorDims& dims) {
+        VectorDims res(rank6D, 1);
+        std::copy(dims.rbegin(), dims.rend(), res.rbegin());
+        return res;
+    };
+
+    exec_domain = extendTo6D(getOutputShapeAtPort(0).getStaticDims());
+    src_dims.clear();
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        src_dims.push_back(extendTo6D(getInputShapeAtPort(i).getStaticDims()));
+    }
+
+    auto isBroadcasted = [&](const VectorDims& dims, size_t axis) {
+        return dims[axis] == 1 && exec_domain[axis] != 1;
+    };
+
+    // Dimensions are collapsed into the innermost one while the broadcasting pattern is the same for all the inputs,
+    // so the kernel is called for longer rows and less outer iterations are required
+    auto collapseLastDims = [](VectorDims& dims) {
+        dims[rank6D - 1] *= dims[rank6D - 2];
+        for (size_t i = rank6D - 2; i > 0; i--) {
+            dims[i] = dims[i - 1];
+        }
+        dims[0] = 1;
+    };
+
+    for (size_t collapsed = 1; collapsed < rank6D; collapsed++) {
+        const bool canCollapse = exec_domain[rank6D - 2] == 1 || exec_domain[rank6D - 1] == 1 ||
+            std::all_of(src_dims.begin(), src_dims.end(), [&](const VectorDims& dims) {
+                return isBroadcasted(dims, rank6D - 2) == isBroadcasted(dims, rank6D - 1);
+            });
+        if (!canCollapse)
+            break;
+
+        for (auto& dims : src_dims) {
+            collapseLastDims(dims);
+        }
+        collapseLastDims(exec_domain);
+    }
+
+    auto computeStrides = [&](const VectorDims& dims) {
+        VectorDims strides(rank6D, 0);
+        size_t stride = 1;
+        for (int i = rank6D - 1; i >= 0; i--) {
+            strides[i] = isBroadcasted(dims, i) ? 0 : stride;
+            stride *= dims[i];
+        }
+        return strides;
+    };
+
+    src_strides.clear();
+    for (const auto& dims : src_dims) {
+        src_strides.push_back(computeStrides(dims));
+    }
+    dst_strides.assign(getOriginalOutputsNumber(), computeStrides(exec_domain));
+
+    // the innermost dimension is split into chunks if the outer dimensions don't provide enough work for all the threads
+    const size_t outerWork = std::accumulate(exec_domain.begin(), exec_domain.end() - 1, size_t(1), std::multiplies<size_t>());
+    const size_t innerWork = exec_domain[rank6D - 1];
+    const size_t nthr = parallel_get_max_threads();
+    // minimal chunk size keeps the kernel call overhead negligible in comparison with the work done
+    const size_t minChunkSize = 256;
+
+    inner_chunk_size = innerWork;
+    inner_chunks_num = 1;
+    if (outerWork < nthr && innerWork > minChunkSize) {
+        const size_t chunksNum = std::min(div_up(nthr, outerWork), div_up(innerWork, minChunkSize));
+        // chunks are aligned to the vector length of the widest isa to avoid scalar tails in the middle of a row
+        inner_chunk_size = rnd_up(div_up(innerWork, chunksNum), cpu_isa_traits<avx512_common>::vlen / sizeof(float));
+        inner_chunks_num = div_up(innerWork, inner_chunk_size);
+    }
+}
+
+void MKLDNNSnippetNode::generate() {
+    ngraph::AxisVector order(rank6D);
+    std::iota(order.begin(), order.end(), 0);
+
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inputShapes;
+    for (const auto& dims : src_dims) {
+        inputShapes.emplace_back(ngraph::Shape(dims.begin(), dims.end()), order, ngraph::element::f32);
+    }
+    ngraph::snippets::op::Subgraph::BlockedShapeVector outputShapes(getOriginalOutputsNumber(),
+        ngraph::snippets::op::Subgraph::BlockedShape{ngraph::Shape(exec_domain.begin(), exec_domain.end()), order, ngraph::element::f32});
+
+    schedule = snippet->generate(outputShapes, inputShapes);
+    if (schedule.ptr == nullptr) {
+        IE_THROW() << errorPrefix << " failed to generate code";
+    }
+}
+
+void MKLDNNSnippetNode::execute(mkldnn::stream strm) {
+    std::vector<const uint8_t*> srcPtrs(src_dims.size());
+    for (size_t i = 0; i < srcPtrs.size(); i++) {
+        srcPtrs[i] = reinterpret_cast<const uint8_t*>(getParentEdgeAt(i)->getMemoryPtr()->GetPtr());
+    }
+    std::vector<uint8_t*> dstPtrs(dst_strides.size());
+    for (size_t i = 0; i < dstPtrs.size(); i++) {
+        dstPtrs[i] = reinterpret_cast<uint8_t*>(getChildEdgesAtPort(i)[0]->getMemoryPtr()->GetPtr());
+    }
+
+    const auto kernel = schedule.get_callable<void (*)(const jit_snippets_call_args*)>();
+    const size_t innerWork = exec_domain[rank6D - 1];
+    const size_t outerWork = std::accumulate(exec_domain.begin(), exec_domain.end() - 1, size_t(1), std::multiplies<size_t>());
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(outerWork * inner_chunks_num, nthr, ithr, start, end);
+
+        jit_snippets_call_args callArgs;
+        size_t indexes[rank6D] = {};
+        for (size_t iwork = start; iwork < end; iwork++) {
+            const size_t innerStart = (iwork % inner_chunks_num) * inner_chunk_size;
+            size_t outer = iwork / inner_chunks_num;
+            for (int j = rank6D - 2; j >= 0; j--) {
+                indexes[j] = outer % exec_domain[j];
+                outer /= exec_domain[j];
+            }
+            indexes[rank6D - 1] = innerStart;
+
+            auto offset = [&](const VectorDims& strides) {
+                size_t off = 0;
+                for (size_t j = 0; j < rank6D; j++)
+                    off += indexes[j] * strides[j];
+                return off * data_size;
+            };
+            for (size_t i = 0; i < srcPtrs.size(); i++)
+                callArgs.src_ptrs[i] = srcPtrs[i] + offset(src_strides[i]);
+            for (size_t i = 0; i < dstPtrs.size(); i++)
+                callArgs.dst_ptrs[i] = dstPtrs[i] + offset(dst_strides[i]);
+            callArgs.work_amount = static_cast<int64_t>(std::min(inner_chunk_size, innerWork - innerStart));
+
+            kernel(&callArgs);
+        }
+    });
+}
@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <snippets/op/subgraph.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include "emitters/jit_snippets_emitters.hpp"
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/// MKLDNNSnippetNode represents subgraph node in MKLDNNPlugin
+/// potentially, snippet can be placed as a postop to any support operation while it doesn't support postops itself
+/// precision: fp32
+/// layout: ncsp
+class MKLDNNSnippetNode : public MKLDNNNode {
+public:
+    MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNSnippetNode() override = default;
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    static const size_t rank6D {SNIPPETS_MAX_SNIPPETS_DIMS};
+
+    // Collapses innermost dimensions while the broadcasting pattern allows to and computes the execution domain
+    void prepareSchedule();
+    void generate();
+
+    // Holds ngraph subgraph with its own set of parameters, so the original graph is not affected by code generation
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+
+    // Holds generated code and the work size it was generated for
+    ngraph::snippets::Schedule schedule;
+
+    // Execution domain in 6D after the dimensions collapsing, the innermost dimension is processed by the kernel
+    VectorDims exec_domain;
+    // Per input/output element strides in 6D, zero stride means the dimension is broadcasted
+    std::vector<VectorDims> src_strides;
+    std::vector<VectorDims> dst_strides;
+    // Input shapes in 6D after the dimensions collapsing, used for code generation
+    std::vector<VectorDims> src_dims;
+
+    // The innermost dimension is split into chunks if outer dimensions don't provide enough parallelism
+    size_t inner_chunk_size = 0;
+    size_t inner_chunks_num = 1;
+
+    size_t data_size = sizeof(float);
+    mkldnn::impl::cpu::x64::cpu_isa_t host_isa;
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
@@ -4,6 +4,8 @@
 
 #include "mkldnn_tensoriterator_node.h"
 
+#include <algorithm>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <map>
@@ -11,6 +13,7 @@
 #include <ie_ngraph_utils.hpp>
 #include <utils/general_utils.h>
 #include "common/blocked_desc_creator.h"
+#include "common/cpu_convert.h"
 #include "utils/ngraph_utils.hpp"
 
 using namespace mkldnn;
@@ -130,6 +133,104 @@ public:
     }
 };
 
+/**
+ * Instead of copying the chunk of the sliced input to the body input it points the memory of the body input edges
+ * to the chunk. Applicable only to a dense chunk of the plain tensor which is not modified by the body.
+ */
+class PortIteratorAliasHelper : public PortMapHelper {
+public:
+    PortIteratorAliasHelper(const MKLDNNMemoryPtr &from, const MKLDNNNodePtr &to, const PortMap &slice_rule) : body_input(to) {
+        const auto &full_dims = from->getStaticDims();
+        const auto axis = slice_rule.axis;
+        const auto abs_stride = std::abs(slice_rule.stride);
+
+        iter_count = full_dims[axis] / abs_stride;
+
+        const size_t inner_size = std::accumulate(full_dims.begin() + axis + 1, full_dims.end(), size_t(1), std::multiplies<size_t>());
+        chunk_stride_in_byte = inner_size * abs_stride * from->getDesc().getPrecision().size();
+        chunk_offset_in_byte = slice_rule.stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= slice_rule.stride < 0 ? -1 : 1;
+
+        full_mem = from->GetPrimitive();
+    }
+
+    void execute(mkldnn::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        MKLDNNGraph::ChangeChildEdgesPtr(body_input, static_cast<uint8_t *>(full_mem.get_data_handle()) +
+                chunk_offset_in_byte + chunk_stride_in_byte * iter);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    MKLDNNNodePtr body_input;
+    mkldnn::memory full_mem;
+
+    int iter_count;
+};
+
+/**
+ * Points the memory of the body output to the chunk of the concatenated output before the iteration,
+ * so the producer of the body output writes the result in place.
+ */
+class PortConcatAliasHelper : public PortMapHelper {
+public:
+    PortConcatAliasHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const PortMap &slice_rule) : body_output(from) {
+        const auto &full_dims = to->getStaticDims();
+        const auto axis = slice_rule.axis;
+        const auto abs_stride = std::abs(slice_rule.stride);
+
+        iter_count = full_dims[axis] / abs_stride;
+
+        const size_t inner_size = std::accumulate(full_dims.begin() + axis + 1, full_dims.end(), size_t(1), std::multiplies<size_t>());
+        chunk_stride_in_byte = inner_size * abs_stride * to->getDesc().getPrecision().size();
+        chunk_offset_in_byte = slice_rule.stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= slice_rule.stride < 0 ? -1 : 1;
+
+        full_mem = to->GetPrimitive();
+    }
+
+    void execute(mkldnn::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        body_output->GetPrimitivePtr()->set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
+                chunk_offset_in_byte + chunk_stride_in_byte * iter);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    MKLDNNMemoryPtr body_output;
+    mkldnn::memory full_mem;
+
+    int iter_count;
+};
+
+/**
+ * Passes the body output to the body input of the next iteration by swapping their buffers (ping-pong)
+ * instead of copying the data.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const MKLDNNMemoryPtr &from, const MKLDNNNodePtr &to) : body_output(from), body_input(to) {}
+
+    void execute(mkldnn::stream strm, int iter) override {
+        if (iter != 0) {
+            void *output_ptr = body_output->GetData();
+            void *input_ptr = body_input->getChildEdgeAt(0)->getMemory().GetData();
+            MKLDNNGraph::ChangeChildEdgesPtr(body_input, output_ptr);
+            body_output->GetPrimitivePtr()->set_data_handle(input_ptr);
+        }
+    }
+
+private:
+    MKLDNNMemoryPtr body_output;
+    MKLDNNNodePtr body_input;
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -197,79 +298,71 @@ private:
 
 }  // namespace MKLDNNPlugin
 
-static int getNumIteration(const std::shared_ptr<const ngraph::Node>& op, const std::vector<PortMap>& inputPortMap, const std::vector<PortMap>& outputPortMap) {
-    const auto isIterable = [](const PortMap& rule) { return rule.axis != -1; };
-
-    const auto getNumIterations = [](const PortMap& rule, const std::vector<size_t>& dimensions) -> int {
-        const auto axis = rule.axis;
-        if (axis < 0 || static_cast<std::size_t>(axis) >= dimensions.size()) {
-            IE_THROW() << R"(: Invalid "axis" value in an iteration component: )"
-                               << rule.axis  << ", dimensions number = " << dimensions.size() << " (out of range)";
-        }
-        const auto space = dimensions[axis];
-        const int start = static_cast<int>((rule.start < 0 ? (space + 1) : 0) + rule.start);
-        const int end   = static_cast<int>((rule.end   < 0 ? (space + 1) : 0) + rule.end);
-
-        const auto stride = rule.stride;
-        if (stride == 0) {
-            IE_THROW() << R"(: Invalid "stride" value in an iteration component: )" << rule.stride << " (infinite loop)";
-        }
-        const auto step = std::abs(stride);
-
-        const auto src = stride < 0 ? end : start;
-        const auto dst = stride < 0 ? start : end;
-        const auto length = dst - src;
-        if (src < 0 || src >= dst || dst > static_cast<int64_t>(space) || length < step) {
-            IE_THROW() << R"(: Invalid "start"/"stride"/"end" values in an iteration component)"
-                               << ": \"start\" = " << rule.start << ", \"stride\" = " << rule.stride  << ", \"end\" = " << rule.end;
-        }
+static int getNumIterations(const PortMap& rule, const std::vector<size_t>& dimensions) {
+    const auto axis = rule.axis;
+    if (axis < 0 || static_cast<std::size_t>(axis) >= dimensions.size()) {
+        IE_THROW() << R"(: Invalid "axis" value in an iteration component: )"
+                           << rule.axis  << ", dimensions number = " << dimensions.size() << " (out of range)";
+    }
+    const auto space = dimensions[axis];
+    const int start = static_cast<int>((rule.start < 0 ? (space + 1) : 0) + rule.start);
+    const int end   = static_cast<int>((rule.end   < 0 ? (space + 1) : 0) + rule.end);
 
-        if (length % step != 0) {
-            IE_THROW() << ": Each iteration must be the same size: length (" << length << ") is not divisible by step (" << step << ")";
-        }
+    const auto stride = rule.stride;
+    if (stride == 0) {
+        IE_THROW() << R"(: Invalid "stride" value in an iteration component: )" << rule.stride << " (infinite loop)";
+    }
+    const auto step = std::abs(stride);
+
+    const auto src = stride < 0 ? end : start;
+    const auto dst = stride < 0 ? start : end;
+    const auto length = dst - src;
+    if (src < 0 || src >= dst || dst > static_cast<int64_t>(space) || length < step) {
+        IE_THROW() << R"(: Invalid "start"/"stride"/"end" values in an iteration component)"
+                           << ": \"start\" = " << rule.start << ", \"stride\" = " << rule.stride  << ", \"end\" = " << rule.end;
+    }
 
-        return static_cast<int>(length / step);
-    };
+    if (length % step != 0) {
+        IE_THROW() << ": Each iteration must be the same size: length (" << length << ") is not divisible by step (" << step << ")";
+    }
 
+    return static_cast<int>(length / step);
+}
 
-    int numIterations = 1;
-    bool isDefault = true;
-    for (const auto& rule : inputPortMap) {
-        if (!isIterable(rule)) {
-            continue;
-        }
+/**
+ * Calculates the number of iterations defined by the sliced inputs and the concatenated outputs.
+ * The rules of the ports with empty (i.e. not yet known) dimensions are skipped.
+ * Returns -1 if there are no such rules.
+ */
+static int getNumIteration(const std::vector<PortMap>& inputPortMap, const std::vector<PortMap>& outputPortMap,
+                           const std::vector<VectorDims>& inputDims, const std::vector<VectorDims>& outputDims) {
+    const auto isIterable = [](const PortMap& rule) { return rule.axis != -1; };
 
-        if (rule.from < 0 || rule.from >= static_cast<int64_t>(op->get_input_size())) {
+    int numIterations = -1;
+    const auto updateNumIterations = [&](const PortMap& rule, const std::vector<VectorDims>& dims) {
+        if (rule.from < 0 || rule.from >= static_cast<int64_t>(dims.size())) {
             IE_THROW() << R"(: Invalid "from" value: "from" = )" << rule.from
-                               << " inputs number = " << op->get_input_size() << " (out of range)";
+                               << " ports number = " << dims.size() << " (out of range)";
         }
+        if (dims[rule.from].empty())
+            return;
 
-        const auto currentNumIterations = getNumIterations(rule, op->get_input_shape(rule.from));
-        if (isDefault) {
-            isDefault = false;
+        const auto currentNumIterations = getNumIterations(rule, dims[rule.from]);
+        if (numIterations == -1) {
             numIterations = currentNumIterations;
         } else if (numIterations != currentNumIterations) {
             IE_THROW() << ": There are at least two different iterations numbers: " << numIterations << " and " << currentNumIterations;
         }
+    };
+
+    for (const auto& rule : inputPortMap) {
+        if (isIterable(rule))
+            updateNumIterations(rule, inputDims);
     }
 
     for (const auto& rule : outputPortMap) {
-        if (!isIterable(rule)) {
-            continue;
-        }
-
-        if (rule.from < 0 || rule.from >= static_cast<int64_t>(op->get_output_size())) {
-            IE_THROW() << R"(: Invalid "from" value: "from" = )" << rule.from
-                               << " inputs number = " << op->get_output_size() << " (out of range)";
-        }
-
-        const auto currentNumIterations = getNumIterations(rule, op->get_output_shape(rule.from));
-        if (isDefault) {
-            isDefault = false;
-            numIterations = currentNumIterations;
-        } else if (numIterations != currentNumIterations) {
-            IE_THROW() << ": There are at least two different iterations numbers: " << numIterations << " and " << currentNumIterations;
-        }
+        if (isIterable(rule))
+            updateNumIterations(rule, outputDims);
     }
 
     return numIterations;
@@ -277,9 +370,17 @@ static int getNumIteration(const std::shared_ptr<const ngraph::Node>& op, const
 
 bool MKLDNNTensorIteratorNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
+        for (const auto& input : op->inputs()) {
+            if (input.get_partial_shape().rank().is_dynamic()) {
+                errorMessage = "Doesn't support op with dynamic rank";
+                return false;
+            }
+        }
+        for (const auto& output : op->outputs()) {
+            if (output.get_partial_shape().rank().is_dynamic()) {
+                errorMessage = "Doesn't support op with dynamic rank";
+                return false;
+            }
         }
 
         if (!one_of(op->get_type_info(),
@@ -316,6 +417,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         if (inNode != inMap.end()) {
             auto inMem = inNode->second->getChildEdgeAt(0)->getMemoryPtr();
             input_mem.push_back(inMem);
+            input_nodes.push_back(inNode->second);
         }
     }
 
@@ -330,6 +432,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         if (outNode != outMap.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
             output_mem.push_back(outMem);
+            output_nodes.push_back(outNode->second);
         }
     }
 
@@ -384,7 +487,15 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         }
     }
 
-    n_iter = getNumIteration(ngraphOp, inputPortMap, outputPortMap);
+    if (!isDynamicNode()) {
+        std::vector<VectorDims> inputDims, outputDims;
+        for (size_t i = 0; i < inputShapes.size(); i++)
+            inputDims.push_back(getInputShapeAtPort(i).getStaticDims());
+        for (size_t i = 0; i < outputShapes.size(); i++)
+            outputDims.push_back(getOutputShapeAtPort(i).getStaticDims());
+
+        n_iter = std::max(getNumIteration(inputPortMap, outputPortMap, inputDims, outputDims), 1);
+    }
 
     if (const auto loopOp = std::dynamic_pointer_cast<const ngraph::op::v5::Loop>(ngraphOp)) {
         auto spec_port = loopOp->get_special_body_ports();
@@ -409,15 +520,50 @@ void MKLDNNTensorIteratorNode::initSupportedPrimitiveDescriptors() {
 }
 
 
+/**
+ * The chunk of the plain tensor is a dense memory region if all the dimensions before the axis are equal to 1
+ */
+static bool isDenseChunk(const MKLDNNMemoryPtr &full, const MKLDNNMemoryPtr &part, const PortMap &rule) {
+    if (!full->getDesc().hasLayoutType(LayoutType::ncsp) || !part->getDesc().hasLayoutType(LayoutType::ncsp))
+        return false;
+    if (full->getDesc().getPrecision() != part->getDesc().getPrecision())
+        return false;
+
+    const auto &dims = full->getStaticDims();
+    return std::all_of(dims.begin(), dims.begin() + rule.axis, [](size_t dim) { return dim == 1; });
+}
+
+bool MKLDNNTensorIteratorNode::canRedirectBodyOutput(int idx) const {
+    const auto edge = output_nodes[idx]->getParentEdgeAt(0);
+    const auto producer = edge->getParent();
+    if (producer->getType() == Input || producer->isConstant() || producer->isInPlace())
+        return false;
+
+    return producer->getChildEdgesAtPort(edge->getInputNum()).size() == 1;
+}
+
 void MKLDNNTensorIteratorNode::createPrimitive() {
+    // the port maps of the dynamic node are applied directly in executeDynamicImpl
+    if (isDynamicNode())
+        return;
+
     const auto &eng = getEngine();
 
+    const auto backEdgesNum = [&](int idx) {
+        return std::count_if(backEdges.begin(), backEdges.end(), [idx](const PortMap &rule) { return rule.from == idx; });
+    };
+    const auto concatOutputsNum = [&](int idx) {
+        return std::count_if(outputPortMap.begin(), outputPortMap.end(), [idx](const PortMap &rule) { return rule.to == idx && rule.axis != -1; });
+    };
+
     for (auto map_rule : inputPortMap) {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &to_mem = input_mem[map_rule.to];
 
         if (map_rule.axis == -1)
             first_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        else if (isDenseChunk(from_mem, to_mem, map_rule) && MKLDNNGraph::CanChangeChildEdgesPtr(input_nodes[map_rule.to]))
+            before_mappers.emplace_back(new PortIteratorAliasHelper(from_mem, input_nodes[map_rule.to], map_rule));
         else
             before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng));
     }
@@ -428,6 +574,9 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
 
         if (map_rule.axis == -1)
             last_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        else if (isDenseChunk(to_mem, from_mem, map_rule) && backEdgesNum(map_rule.to) == 0 &&
+                 concatOutputsNum(map_rule.to) == 1 && canRedirectBodyOutput(map_rule.to))
+            before_mappers.emplace_back(new PortConcatAliasHelper(from_mem, to_mem, map_rule));
         else
             after_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, false, map_rule, eng));
     }
@@ -436,7 +585,11 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mem[map_rule.to];
 
-        before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        if (from_mem->getDesc().isCompatible(to_mem->getDesc()) && backEdgesNum(map_rule.from) == 1 &&
+                canRedirectBodyOutput(map_rule.from) && MKLDNNGraph::CanChangeChildEdgesPtr(input_nodes[map_rule.to]))
+            before_mappers.emplace_back(new BackEdgeSwapHelper(from_mem, input_nodes[map_rule.to]));
+        else
+            before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
     }
 
     // special purpose ports
@@ -496,6 +649,176 @@ void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
         mapper->execute(strm);
 }
 
+const MKLDNNMemoryPtr& MKLDNNTensorIteratorNode::redefineBodyInput(int idx, const VectorDims& dims) {
+    const auto &node = input_nodes[idx];
+    if (node->isDynamicNode()) {
+        node->redefineOutputMemory({dims});
+    } else {
+        const size_t size = std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>());
+        if (input_mem[idx]->GetShape().getElementsCount() != size)
+            IE_THROW() << "TensorIterator node with name: " << getName() << " has incompatible shape of the body input " << idx;
+    }
+    return input_mem[idx];
+}
+
+void MKLDNNTensorIteratorNode::executeDynamicImpl(mkldnn::stream strm) {
+    using InferenceEngine::Precision;
+
+    const auto readScalar = [](const MKLDNNMemoryPtr &mem) {
+        int32_t value = 0;
+        cpu_convert(mem->GetPtr(), &value, mem->getDesc().getPrecision(), Precision::I32, 1);
+        return value;
+    };
+    const auto elementsCount = [](VectorDims::const_iterator begin, VectorDims::const_iterator end) {
+        return std::accumulate(begin, end, size_t(1), std::multiplies<size_t>());
+    };
+
+    sub_graph.ResetInferCount();
+
+    std::vector<VectorDims> inputDims, outputDims;
+    for (size_t i = 0; i < inputShapes.size(); i++)
+        inputDims.push_back(getParentEdgesAtPort(i)[0]->getMemory().getStaticDims());
+    for (size_t i = 0; i < outputShapes.size(); i++)
+        outputDims.push_back(getOutputShapeAtPort(i).isStatic() ? getOutputShapeAtPort(i).getStaticDims() : VectorDims{});
+
+    const int numIterations = getNumIteration(inputPortMap, outputPortMap, inputDims, outputDims);
+
+    int max_num_iter = std::max(numIterations, 1);
+    bool continue_cond = true;
+    if (loopTripCountIdx != -1) {
+        max_num_iter = readScalar(getParentEdgesAtPort(loopTripCountIdx)[0]->getMemoryPtr());
+        // the sliced inputs limit the number of iterations of the infinite loop as well
+        if (numIterations != -1 && (max_num_iter < 0 || max_num_iter > numIterations))
+            max_num_iter = numIterations;
+    }
+    if (loopExecutionConditionIdx != -1)
+        continue_cond = readScalar(getParentEdgesAtPort(loopExecutionConditionIdx)[0]->getMemoryPtr()) != 0;
+
+    // the concatenated outputs are accumulated in the precision of the body until the number of iterations is known
+    std::vector<std::vector<uint8_t>> concatBuffers(outputPortMap.size());
+    std::vector<VectorDims> concatPartDims(outputPortMap.size());
+
+    // use  "i != max_num_iter" only to allow "-1" works like infinite loop
+    int iterations = 0;
+    for (; iterations != max_num_iter && continue_cond; iterations++) {
+        const int i = iterations;
+
+        for (const auto &rule : inputPortMap) {
+            const auto &from_mem = getParentEdgesAtPort(rule.from)[0]->getMemoryPtr();
+            const auto &full_dims = from_mem->getStaticDims();
+            const auto src_prc = from_mem->getDesc().getPrecision();
+
+            if (rule.axis == -1) {
+                if (i == 0) {
+                    const auto &to_mem = redefineBodyInput(rule.to, full_dims);
+                    cpu_convert(from_mem->GetPtr(), to_mem->GetPtr(), src_prc, to_mem->getDesc().getPrecision(),
+                                elementsCount(full_dims.begin(), full_dims.end()));
+                }
+                continue;
+            }
+
+            const size_t space = full_dims[rule.axis];
+            const size_t step = std::abs(rule.stride);
+            const int begin = static_cast<int>((rule.start < 0 ? (space + 1) : 0) + rule.start);
+            const int end   = static_cast<int>((rule.end   < 0 ? (space + 1) : 0) + rule.end);
+            const size_t chunk_idx = rule.stride > 0 ? static_cast<size_t>(begin) + i * step : static_cast<size_t>(end) - (i + 1) * step;
+
+            auto part_dims = full_dims;
+            part_dims[rule.axis] = step;
+            const auto &to_mem = redefineBodyInput(rule.to, part_dims);
+            const auto dst_prc = to_mem->getDesc().getPrecision();
+
+            const size_t outer = elementsCount(full_dims.begin(), full_dims.begin() + rule.axis);
+            const size_t inner = elementsCount(full_dims.begin() + rule.axis + 1, full_dims.end());
+            const auto src = static_cast<const uint8_t*>(from_mem->GetPtr());
+            const auto dst = static_cast<uint8_t*>(to_mem->GetPtr());
+            for (size_t o = 0; o < outer; o++) {
+                cpu_convert(src + ((o * space + chunk_idx) * inner) * src_prc.size(),
+                            dst + o * step * inner * dst_prc.size(), src_prc, dst_prc, step * inner);
+            }
+        }
+
+        if (i != 0) {
+            for (const auto &rule : backEdges) {
+                const auto &from_mem = output_mem[rule.from];
+                const auto &dims = from_mem->getStaticDims();
+                const auto &to_mem = redefineBodyInput(rule.to, dims);
+                if (to_mem->GetPtr() != from_mem->GetPtr()) {
+                    cpu_convert(from_mem->GetPtr(), to_mem->GetPtr(), from_mem->getDesc().getPrecision(),
+                                to_mem->getDesc().getPrecision(), elementsCount(dims.begin(), dims.end()));
+                }
+            }
+        }
+
+        for (auto idx : loopBodyCurrentIterationIdx) {
+            const auto &to_mem = redefineBodyInput(idx, {1});
+            cpu_convert(&i, to_mem->GetPtr(), Precision::I32, to_mem->getDesc().getPrecision(), 1);
+        }
+
+        sub_graph.Infer();
+
+        if (loopBodyConditionOutputIdx != -1)
+            continue_cond = readScalar(output_mem[loopBodyConditionOutputIdx]) != 0;
+
+        for (size_t j = 0; j < outputPortMap.size(); j++) {
+            const auto &rule = outputPortMap[j];
+            if (rule.axis == -1)
+                continue;
+
+            const auto &from_mem = output_mem[rule.to];
+            const auto &dims = from_mem->getStaticDims();
+            if (i == 0) {
+                concatPartDims[j] = dims;
+            } else if (concatPartDims[j] != dims) {
+                IE_THROW() << "TensorIterator node with name: " << getName()
+                           << " has body output " << rule.to << " which shape changes between iterations";
+            }
+            const auto data = static_cast<const uint8_t*>(from_mem->GetPtr());
+            concatBuffers[j].insert(concatBuffers[j].end(), data, data + from_mem->GetSize());
+        }
+    }
+
+    std::vector<VectorDims> newOutputDims(outputShapes.size());
+    for (size_t j = 0; j < outputPortMap.size(); j++) {
+        const auto &rule = outputPortMap[j];
+        if (rule.axis == -1) {
+            newOutputDims[rule.from] = output_mem[rule.to]->getStaticDims();
+        } else {
+            if (iterations == 0)
+                concatPartDims[j] = output_mem[rule.to]->getStaticDims();
+            newOutputDims[rule.from] = concatPartDims[j];
+            newOutputDims[rule.from][rule.axis] *= iterations;
+        }
+    }
+    redefineOutputMemory(newOutputDims);
+
+    for (size_t j = 0; j < outputPortMap.size(); j++) {
+        const auto &rule = outputPortMap[j];
+        const auto &from_mem = output_mem[rule.to];
+        const auto &to_mem = getChildEdgesAtPort(rule.from)[0]->getMemoryPtr();
+        const auto src_prc = from_mem->getDesc().getPrecision();
+        const auto dst_prc = to_mem->getDesc().getPrecision();
+
+        if (rule.axis == -1) {
+            const auto &dims = from_mem->getStaticDims();
+            cpu_convert(from_mem->GetPtr(), to_mem->GetPtr(), src_prc, dst_prc, elementsCount(dims.begin(), dims.end()));
+            continue;
+        }
+
+        const auto &part_dims = concatPartDims[j];
+        const size_t outer = elementsCount(part_dims.begin(), part_dims.begin() + rule.axis);
+        const size_t part = elementsCount(part_dims.begin() + rule.axis, part_dims.end());
+        const auto dst = static_cast<uint8_t*>(to_mem->GetPtr());
+        for (int it = 0; it < iterations; it++) {
+            const size_t pos = rule.stride < 0 ? iterations - 1 - it : it;
+            for (size_t o = 0; o < outer; o++) {
+                cpu_convert(concatBuffers[j].data() + (it * outer + o) * part * src_prc.size(),
+                            dst + (o * iterations + pos) * part * dst_prc.size(), src_prc, dst_prc, part);
+            }
+        }
+    }
+}
+
 bool MKLDNNTensorIteratorNode::created() const {
     return getType() == TensorIterator;
 }
@@ -66,14 +66,27 @@ public:
     bool created() const override;
     void execute(mkldnn::stream strm) override;
 
+    bool needShapeInfer() const override { return false; }
+    bool needPrepareParams() const override { return false; }
+    void executeDynamicImpl(mkldnn::stream strm) override;
+
     void setExtManager(const MKLDNNExtensionManager::Ptr& extMgr) { ext_mng = extMgr; }
 
 private:
+    /**
+     * Checks whether the body output may be written directly to an external buffer, i.e. the producer
+     * writes it to its own memory which is not shared with any other consumer
+     */
+    bool canRedirectBodyOutput(int idx) const;
+
+    const MKLDNNMemoryPtr& redefineBodyInput(int idx, const VectorDims& dims);
+
     int n_iter = 0;
 
     MKLDNNExtensionManager::Ptr ext_mng;
     MKLDNNGraph sub_graph;
     std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
+    std::vector<MKLDNNNodePtr> input_nodes, output_nodes;
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 
 #include <ngraph/opsets/opset1.hpp>
@@ -11,12 +12,138 @@
 #include "mkldnn_topk_node.h"
 #include "utils/general_utils.h"
 
+#include <cpu/x64/jit_generator.hpp>
+
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
 #endif
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_topk_filter_call_args, field)
+
+namespace {
+
+// the axes shorter than this are sorted by insertion
+constexpr int partialMinDim = 64;
+// the reduction axis is split between the threads if there are not enough rows to occupy them
+constexpr int splitMinDim = 16384;
+// the elements are filtered by chunks, the threshold is updated between them
+constexpr int filterChunk = 1024;
+
+// NaN is greater than any number
+inline bool isGreater(float lhs, float rhs) {
+    return lhs > rhs || (std::isnan(lhs) && !std::isnan(rhs));
+}
+
+}  // namespace
+
+template <cpu_isa_t isa>
+struct jit_uni_topk_filter_kernel_f32 : public jit_uni_topk_filter_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_topk_filter_kernel_f32)
+
+    explicit jit_uni_topk_filter_kernel_f32(jit_topk_filter_config_params jcp) : jit_uni_topk_filter_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_index, ptr[reg_params + GET_OFF(start)]);
+        uni_vbroadcastss(vmm_threshold, ptr[reg_params + GET_OFF(threshold)]);
+        xor_(reg_passed, reg_passed);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+        Xbyak::Label bits_label;
+        Xbyak::Label skip_label;
+        L(loop_label); {
+            cmp(reg_work_amount, 0);
+            jle(loop_end_label, T_NEAR);
+
+            uni_vmovups(vmm_src, ptr[reg_src]);
+            // !(src < threshold) for max and !(threshold < src) for min, so NaN passes as well
+            if (jcp_.mode_max)
+                cmp_ps(vmm_src, vmm_threshold);
+            else
+                cmp_ps(vmm_threshold, vmm_src);
+            store_mask_bits(reg_bits);
+
+            test(reg_bits, reg_bits);
+            jz(skip_label, T_NEAR);
+            L(bits_label); {
+                bsf(reg_tmp, reg_bits);
+                add(reg_tmp, reg_index);
+                mov(dword[reg_dst + reg_passed * sizeof(int)], reg_tmp.cvt32());
+                add(reg_passed, 1);
+                lea(reg_tmp, ptr[reg_bits - 1]);
+                and_(reg_bits, reg_tmp);
+                jnz(bits_label, T_NEAR);
+            }
+            L(skip_label);
+
+            add(reg_src, vlen);
+            add(reg_index, simd_w);
+            sub(reg_work_amount, 1);
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        mov(reg_tmp, ptr[reg_params + GET_OFF(passed)]);
+        mov(ptr[reg_tmp], reg_passed);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == sse41, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+    const size_t simd_w = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_index = r11;
+    Xbyak::Reg64 reg_passed = r12;
+    Xbyak::Reg64 reg_bits = r13;
+    Xbyak::Reg64 reg_tmp = rax;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_mask = Vmm(0);
+    Vmm vmm_src = Vmm(1);
+    Vmm vmm_threshold = Vmm(2);
+
+    const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+
+    inline void cmp_ps(Vmm vmm_src0, Vmm vmm_src1) {
+        if (isa == sse41) {
+            uni_vmovups(vmm_mask, vmm_src0);
+            cmpps(vmm_mask, vmm_src1, _cmp_nlt_us);
+        } else if (isa == avx2) {
+            vcmpps(vmm_mask, vmm_src0, vmm_src1, _cmp_nlt_us);
+        } else {
+            vcmpps(k_mask, vmm_src0, vmm_src1, _cmp_nlt_us);
+        }
+    }
+
+    inline void store_mask_bits(const Xbyak::Reg64& reg) {
+        if (isa == sse41)
+            movmskps(reg.cvt32(), vmm_mask);
+        else if (isa == avx2)
+            vmovmskps(reg.cvt32(), vmm_mask);
+        else
+            kmovw(reg.cvt32(), k_mask);
+    }
+};
 
 bool MKLDNNTopKNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
@@ -122,7 +249,9 @@ void MKLDNNTopKNode::execute(mkldnn::stream strm) {
     dim = static_cast<int>(in_dims[axis]);
     before_num = count(in_dims, 0, axis);
 
-    if (src_k == 1) {
+    if (src_k > 1 && dim >= partialMinDim && (is_last_dim || src_k >= 16)) {
+        topk_partial(src, dst_data, dst_idx, in_dims);
+    } else if (src_k == 1) {
         if (is_last_dim) {
             if (mode_max)
                 top1<std::greater>(src, dst_data, dst_idx, in_dims);
@@ -162,6 +291,23 @@ void MKLDNNTopKNode::executeDynamicImpl(mkldnn::stream strm) {
 }
 
 void MKLDNNTopKNode::createPrimitive() {
+    if (!filter_kernel) {
+        auto jcp = jit_topk_filter_config_params();
+        jcp.mode_max = mode_max;
+        if (mayiuse(avx512_common)) {
+            filter_kernel.reset(new jit_uni_topk_filter_kernel_f32<avx512_common>(jcp));
+            filter_simd_w = 16;
+        } else if (mayiuse(avx2)) {
+            filter_kernel.reset(new jit_uni_topk_filter_kernel_f32<avx2>(jcp));
+            filter_simd_w = 8;
+        } else if (mayiuse(sse41)) {
+            filter_kernel.reset(new jit_uni_topk_filter_kernel_f32<sse41>(jcp));
+            filter_simd_w = 4;
+        }
+        if (filter_kernel)
+            filter_kernel->create_ker();
+    }
+
     if (inputShapesDefined()) {
         updateLastInputDims();
     }
@@ -494,6 +640,147 @@ void MKLDNNTopKNode::topk(const float* src_data, float* dst_data, int* dst_idx,
     });
 }
 
+bool MKLDNNTopKNode::isBetter(const TopKCandidate& lhs, const TopKCandidate& rhs) const {
+    const bool greater = mode_max ? isGreater(lhs.value, rhs.value) : isGreater(rhs.value, lhs.value);
+    if (greater)
+        return true;
+    const bool less = mode_max ? isGreater(rhs.value, lhs.value) : isGreater(lhs.value, rhs.value);
+    if (less)
+        return false;
+    return lhs.index < rhs.index;
+}
+
+void MKLDNNTopKNode::selectTopK(const float* src, int begin, int end, std::vector<TopKCandidate>& top) const {
+    auto better = [this](const TopKCandidate& lhs, const TopKCandidate& rhs) {
+        return isBetter(lhs, rhs);
+    };
+    auto shrink = [&]() {
+        std::nth_element(top.begin(), top.begin() + src_k - 1, top.end(), better);
+        top.resize(src_k);
+    };
+
+    top.clear();
+    const int first_end = std::min(end, begin + src_k);
+    for (int i = begin; i < first_end; i++)
+        top.push_back({src[i], i});
+    if (first_end == end)
+        return;
+    float threshold = std::max_element(top.begin(), top.end(), better)->value;
+
+    // only the elements not worse than the k-th one seen so far become the candidates, the candidates are reduced
+    // back to k by quickselect, which tightens the threshold
+    std::vector<int> passed(filterChunk);
+    for (int chunk_begin = first_end; chunk_begin < end; chunk_begin += filterChunk) {
+        const int chunk_end = std::min(end, chunk_begin + filterChunk);
+        size_t passed_num = 0;
+        int tail_begin = chunk_begin;
+        if (filter_kernel) {
+            auto args = jit_topk_filter_call_args();
+            args.src = src + chunk_begin;
+            args.dst = passed.data();
+            args.work_amount = (chunk_end - chunk_begin) / filter_simd_w;
+            args.start = chunk_begin;
+            args.threshold = threshold;
+            args.passed = &passed_num;
+            (*filter_kernel)(&args);
+            tail_begin += static_cast<int>(args.work_amount * filter_simd_w);
+        }
+        for (int i = tail_begin; i < chunk_end; i++) {
+            const bool pass = mode_max ? !(src[i] < threshold) : !(threshold < src[i]);
+            if (pass)
+                passed[passed_num++] = i;
+        }
+
+        for (size_t i = 0; i < passed_num; i++)
+            top.push_back({src[passed[i]], passed[i]});
+        if (top.size() >= 2 * static_cast<size_t>(src_k)) {
+            shrink();
+            threshold = top[src_k - 1].value;
+        }
+    }
+    if (top.size() > static_cast<size_t>(src_k))
+        shrink();
+}
+
+void MKLDNNTopKNode::storeTopK(std::vector<TopKCandidate>& top, float* dst_data, int* dst_idx, size_t offset, size_t stride) const {
+    if (sort_value) {
+        std::sort(top.begin(), top.end(), [this](const TopKCandidate& lhs, const TopKCandidate& rhs) {
+            return isBetter(lhs, rhs);
+        });
+    } else {
+        std::sort(top.begin(), top.end(), [](const TopKCandidate& lhs, const TopKCandidate& rhs) {
+            return lhs.index < rhs.index;
+        });
+    }
+    for (size_t i = 0; i < top.size(); i++) {
+        if (dst_data)
+            dst_data[offset + i * stride] = top[i].value;
+        if (dst_idx)
+            dst_idx[offset + i * stride] = top[i].index;
+    }
+}
+
+// The cost of the insertion is O(dim * k), so for the long axes the candidates are filtered by the threshold of the
+// current k-th value and selected by quickselect, which is O(dim) on average. The rows of a strided axis are gathered
+// to the contiguous buffer first.
+void MKLDNNTopKNode::topk_partial(const float* src_data, float* dst_data, int* dst_idx, VectorDims in_dims) {
+    const int after_num = count(in_dims, axis + 1, in_dims.size());
+    const int rows = before_num * after_num;
+    const int nthr = parallel_get_max_threads();
+
+    auto getRow = [&](int row, std::vector<float>& buffer) {
+        const int i0 = row / after_num;
+        const int i1 = row % after_num;
+        const float* src = src_data + i0 * dim * after_num + i1;
+        if (after_num == 1)
+            return src;
+        buffer.resize(dim);
+        for (int i2 = 0; i2 < dim; i2++)
+            buffer[i2] = src[i2 * after_num];
+        return static_cast<const float*>(buffer.data());
+    };
+    auto getOffset = [&](int row) {
+        return static_cast<size_t>(row / after_num) * src_k * after_num + row % after_num;
+    };
+
+    if (rows >= nthr || dim < splitMinDim) {
+        parallel_for(rows, [&](int row) {
+            std::vector<float> buffer;
+            std::vector<TopKCandidate> top;
+            selectTopK(getRow(row, buffer), 0, dim, top);
+            storeTopK(top, dst_data, dst_idx, getOffset(row), after_num);
+        });
+        return;
+    }
+
+    // a few long rows (e.g. the beam search over a large vocabulary): every row is split between the threads and
+    // the partial results are merged
+    std::vector<float> buffer;
+    std::vector<std::vector<TopKCandidate>> partial(nthr);
+    std::vector<TopKCandidate> top;
+    for (int row = 0; row < rows; row++) {
+        const float* src = getRow(row, buffer);
+        for (auto& part : partial)
+            part.clear();
+        parallel_nt(nthr, [&](const int ithr, const int team) {
+            int start = 0, end = 0;
+            splitter(dim, team, ithr, start, end);
+            if (start < end)
+                selectTopK(src, start, end, partial[ithr]);
+        });
+
+        top.clear();
+        for (const auto& part : partial)
+            top.insert(top.end(), part.begin(), part.end());
+        if (top.size() > static_cast<size_t>(src_k)) {
+            std::nth_element(top.begin(), top.begin() + src_k - 1, top.end(),
+                             [this](const TopKCandidate& lhs, const TopKCandidate& rhs) { return isBetter(lhs, rhs); });
+            top.resize(src_k);
+        }
+        storeTopK(top, dst_data, dst_idx, getOffset(row), after_num);
+    }
+}
+
 inline int MKLDNNTopKNode::count(VectorDims dims, size_t start_ind, size_t end_ind) {
     size_t count = 1;
     for (size_t i = start_ind; i < end_ind; i++)
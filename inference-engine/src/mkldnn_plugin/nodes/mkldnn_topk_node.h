@@ -7,9 +7,42 @@
 #include "ie_common.h"
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
+struct jit_topk_filter_config_params {
+    bool mode_max;
+};
+
+struct jit_topk_filter_call_args {
+    const float *src;
+    int *dst;
+    size_t work_amount;
+    size_t start;
+    float threshold;
+    size_t *passed;
+};
+
+// writes the indexes of the elements not worse than the threshold
+struct jit_uni_topk_filter_kernel {
+    void (*ker_)(const jit_topk_filter_call_args *);
+
+    void operator()(const jit_topk_filter_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_topk_filter_kernel(jit_topk_filter_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_topk_filter_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_topk_filter_config_params jcp_;
+};
+
 class MKLDNNTopKNode : public MKLDNNNode {
 public:
     MKLDNNTopKNode(const std::shared_ptr<ngraph::Node> &op, const mkldnn::engine &eng,
@@ -80,7 +113,18 @@ public:
     template<template<typename> class Compare>
     void topk(const float *src_data, float *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
 
+    void topk_partial(const float *src_data, float *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
+
 private:
+    struct TopKCandidate {
+        float value;
+        int index;
+    };
+
+    bool isBetter(const TopKCandidate &lhs, const TopKCandidate &rhs) const;
+    void selectTopK(const float *src, int begin, int end, std::vector<TopKCandidate> &top) const;
+    void storeTopK(std::vector<TopKCandidate> &top, float *dst_data, int *dst_idx, size_t offset, size_t stride) const;
+
     const size_t TOPK_DATA = 0;
     const size_t TOPK_K = 1;
     const size_t TOPK_VALUE = 0;
@@ -96,6 +140,9 @@ private:
 
     std::string errorPrefix;
 
+    std::shared_ptr<jit_uni_topk_filter_kernel> filter_kernel;
+    size_t filter_simd_w = 1;
+
 #if defined(HAVE_AVX512F)
     const int count_vec = 32;
 #elif defined(HAVE_SSE) || defined(HAVE_AVX2)
@@ -123,7 +123,14 @@ void MKLDNNTransposeNode::prepareParams() {
         params.order.assign(orderPtr, orderPtr + orderLen);
     }
 
-    execPtr = std::make_shared<TransposeJitExecutor>(params);
+    // the permute kernel is compiled for the particular dims, so the kernels compiled for the shapes met before are
+    // kept to avoid the recompilation when the dynamic shapes are changed back
+    PrimitiveCacheKey key;
+    key.inputDims = {params.src_block_dims, params.dst_block_dims};
+    key.params = params.order;
+    execPtr = jitExecutorsCache.getOrCreate(key, [&](const PrimitiveCacheKey&) {
+        return std::make_shared<TransposeJitExecutor>(params);
+    });
 }
 
 void MKLDNNTransposeNode::createPrimitive() {
@@ -136,6 +143,8 @@ void MKLDNNTransposeNode::createPrimitive() {
     if (getSelectedPrimitiveDescriptor() == nullptr)
         IE_THROW() << "Preferable primitive descriptor was not set.";
 
+    jitExecutorsCache.setCapacity(primitivesCache.capacity());
+
     if (getParentEdgeAt(INPUT_DATA_IDX)->getMemory().getDesc().hasLayoutType(LayoutType::ncsp) &&
             std::find(optimizedOrders.begin(), optimizedOrders.end(), order) != optimizedOrders.end()) {
         isOptimized = true;
@@ -45,6 +45,7 @@ private:
     };
     using executorPtr = std::shared_ptr<TransposeExecutor>;
     executorPtr execPtr = nullptr;
+    LruCache<PrimitiveCacheKey, executorPtr, PrimitiveCacheKeyHasher> jitExecutorsCache;
 
     struct TransposeJitExecutor : public TransposeExecutor {
         TransposeJitExecutor(const PermuteParams& params);
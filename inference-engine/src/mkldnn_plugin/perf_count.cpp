@@ -0,0 +1,187 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_count.h"
+
+#include <ie_parallel.hpp>
+
+#include <memory>
+#include <utility>
+
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+#include <tbb/task_scheduler_observer.h>
+#endif
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace MKLDNNPlugin {
+
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+// observes all the arenas, so the threads of the other streams are attached too
+class HwPerfCounters::WorkersObserver : public tbb::task_scheduler_observer {
+public:
+    explicit WorkersObserver(HwPerfCounters& counters) : counters(counters) {
+        observe(true);
+    }
+    ~WorkersObserver() override {
+        observe(false);
+    }
+
+    void on_scheduler_entry(bool) override {
+        counters.attachCurrentThread();
+    }
+
+private:
+    HwPerfCounters& counters;
+};
+#else
+class HwPerfCounters::WorkersObserver {};
+#endif
+
+void HwPerfCounters::attachWorkers() {
+    attachCurrentThread();
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    if (!workersObserver)
+        workersObserver.reset(new WorkersObserver(*this));
+#else
+    InferenceEngine::parallel_nt(0, [&](const int, const int) {
+        attachCurrentThread();
+    });
+#endif
+}
+
+#ifdef __linux__
+
+namespace {
+
+// the order of the events matches the order of the values read from the group
+const std::vector<std::pair<uint32_t, uint64_t>> hwEvents = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+};
+
+int openEvent(uint32_t type, uint64_t config, int groupFd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = groupFd == -1 ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    // the calling thread on any CPU
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+
+}  // namespace
+
+HwPerfCounters::~HwPerfCounters() {
+    // no threads are attached after the observer is destroyed
+    workersObserver.reset();
+    auto counters = threadCounters.load();
+    while (counters) {
+        for (auto fd : counters->fds)
+            close(fd);
+        std::unique_ptr<ThreadCounters> current(counters);
+        counters = counters->next;
+    }
+}
+
+bool HwPerfCounters::isAttached(std::thread::id threadId, bool& available) const {
+    for (auto counters = threadCounters.load(std::memory_order_acquire); counters; counters = counters->next) {
+        if (counters->threadId == threadId) {
+            available = counters->groupFd != -1;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool HwPerfCounters::attachCurrentThread() {
+    const auto threadId = std::this_thread::get_id();
+    bool available = false;
+    // the threads enter the task scheduler often, so the attached ones are checked without the mutex
+    if (isAttached(threadId, available))
+        return available;
+
+    std::lock_guard<std::mutex> lock(attachMutex);
+    if (isAttached(threadId, available))
+        return available;
+
+    // the failure is also remembered to not retry on each inference
+    std::unique_ptr<ThreadCounters> counters(new ThreadCounters());
+    counters->threadId = threadId;
+    for (const auto& event : hwEvents) {
+        const int fd = openEvent(event.first, event.second, counters->groupFd);
+        if (fd == -1) {
+            for (auto opened : counters->fds)
+                close(opened);
+            counters->fds.clear();
+            counters->groupFd = -1;
+            break;
+        }
+        if (counters->groupFd == -1)
+            counters->groupFd = fd;
+        counters->fds.push_back(fd);
+    }
+    const bool attached = counters->groupFd != -1;
+    if (attached) {
+        ioctl(counters->groupFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(counters->groupFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+    counters->next = threadCounters.load(std::memory_order_relaxed);
+    threadCounters.store(counters.release(), std::memory_order_release);
+    return attached;
+}
+
+HwCounterValues HwPerfCounters::read() const {
+    HwCounterValues result;
+    for (auto counters = threadCounters.load(std::memory_order_acquire); counters; counters = counters->next) {
+        if (counters->groupFd == -1)
+            continue;
+        // PERF_FORMAT_GROUP layout with the times: the number of the events, the time the group was enabled and the time
+        // it was actually counting, followed by the values of the events
+        uint64_t values[6] = {};
+        if (::read(counters->groupFd, values, sizeof(values)) < static_cast<ssize_t>(sizeof(uint64_t) * (3 + hwEvents.size())))
+            continue;
+        const uint64_t enabled = values[1];
+        const uint64_t running = values[2];
+        // the group was multiplexed with other events, the values are extrapolated to the whole enabled time
+        auto scale = [&](uint64_t value) {
+            if (running == 0 || running >= enabled)
+                return value;
+            return static_cast<uint64_t>(static_cast<double>(value) * enabled / running);
+        };
+        result.cycles += scale(values[3]);
+        result.instructions += scale(values[4]);
+        result.llcMisses += scale(values[5]);
+    }
+    return result;
+}
+
+#else
+
+HwPerfCounters::~HwPerfCounters() {
+    workersObserver.reset();
+}
+
+bool HwPerfCounters::attachCurrentThread() {
+    return false;
+}
+
+HwCounterValues HwPerfCounters::read() const {
+    return {};
+}
+
+#endif
+
+}  // namespace MKLDNNPlugin
@@ -4,15 +4,91 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <memory>
 #include <ratio>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
+/**
+ * Values of the hardware performance counters
+ */
+struct HwCounterValues {
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t llcMisses = 0;
+
+    HwCounterValues& operator+=(const HwCounterValues& rhs) {
+        cycles += rhs.cycles;
+        instructions += rhs.instructions;
+        llcMisses += rhs.llcMisses;
+        return *this;
+    }
+};
+
+/**
+ * Linux perf_event counters of the threads executing a graph. The counters are per thread: the counters of a thread
+ * are opened by the thread itself, while the values of all the attached threads are read and summed together. So the
+ * counters of a node include the work of every thread which takes part in its execution, but also the work the
+ * attached threads do for the other streams and the concurrently executed nodes in the meantime. The values are
+ * scaled by the time the counters were scheduled, since the PMU may be multiplexed between the events
+ */
+class HwPerfCounters {
+public:
+    HwPerfCounters() = default;
+    HwPerfCounters(const HwPerfCounters&) = delete;
+    HwPerfCounters& operator=(const HwPerfCounters&) = delete;
+    ~HwPerfCounters();
+
+    /**
+     * @brief Opens the counters of the calling thread unless they are opened already
+     * @return false if the counters are not available, e.g. not Linux or perf_event_paranoid forbids them
+     */
+    bool attachCurrentThread();
+
+    /**
+     * @brief Opens the counters of the calling thread and of the worker threads. With TBB the workers are attached
+     * by an observer when they enter the task scheduler, so the workers joining later are attached as well.
+     * Otherwise the threads of a parallel region are attached at once. Is expected to be called once
+     */
+    void attachWorkers();
+
+    /**
+     * @brief Returns the sum of the counters of all the attached threads, doesn't block the attaching threads
+     */
+    HwCounterValues read() const;
+
+private:
+    struct ThreadCounters {
+        std::thread::id threadId;
+        int groupFd = -1;  // the group leader, the values of the whole group are read through it
+        std::vector<int> fds;
+        ThreadCounters* next = nullptr;
+    };
+
+    bool isAttached(std::thread::id threadId, bool& available) const;
+
+    // the threads are attached under the mutex, while read() walks the list without it: an item is never changed
+    // after it is published as the head of the list
+    std::mutex attachMutex;
+    std::atomic<ThreadCounters*> threadCounters{nullptr};
+
+    class WorkersObserver;
+    std::unique_ptr<WorkersObserver> workersObserver;
+};
+
 class PerfCount {
     uint64_t total_duration;
     uint32_t num;
 
+    const HwPerfCounters* hwCounters = nullptr;
+    HwCounterValues hwStart;
+    HwCounterValues hwTotal;
+
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
 
@@ -25,8 +101,25 @@ public:
 
     uint64_t avg() const { return (num == 0) ? 0 : total_duration / num; }
 
+    /**
+     * @brief Average values of the hardware counters per execution, zeros if they are not collected
+     */
+    HwCounterValues hwAvg() const {
+        HwCounterValues result;
+        if (num != 0) {
+            result.cycles = hwTotal.cycles / num;
+            result.instructions = hwTotal.instructions / num;
+            result.llcMisses = hwTotal.llcMisses / num;
+        }
+        return result;
+    }
+
 private:
-    void start_itr() {
+    // the hardware counters are read outside of the timed interval, so the time doesn't include the reading
+    void start_itr(const HwPerfCounters* hw) {
+        hwCounters = hw;
+        if (hwCounters)
+            hwStart = hwCounters->read();
         __start = std::chrono::high_resolution_clock::now();
     }
 
@@ -34,6 +127,12 @@ private:
         __finish = std::chrono::high_resolution_clock::now();
         total_duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
         num++;
+        if (hwCounters) {
+            const auto hwFinish = hwCounters->read();
+            hwTotal.cycles += hwFinish.cycles - hwStart.cycles;
+            hwTotal.instructions += hwFinish.instructions - hwStart.instructions;
+            hwTotal.llcMisses += hwFinish.llcMisses - hwStart.llcMisses;
+        }
     }
 
     friend class PerfHelper;
@@ -43,12 +142,14 @@ class PerfHelper {
     PerfCount &counter;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    explicit PerfHelper(PerfCount &count, const HwPerfCounters* hwCounters = nullptr): counter(count) {
+        counter.start_itr(hwCounters);
+    }
 
     ~PerfHelper() { counter.finish_itr(); }
 };
 
 }  // namespace MKLDNNPlugin
 
-#define GET_PERF(_node) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter()))
-#define PERF(_node, _need) auto pc = _need ? GET_PERF(_node) : nullptr;
+#define GET_PERF(_node, _hw) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter(), _hw))
+#define PERF(_node, _need, _hw) auto pc = _need ? GET_PERF(_node, _hw) : nullptr;
@@ -27,6 +27,7 @@ public:
         readParam(blobDumpNodeName, "OV_CPU_BLOB_DUMP_NODE_NAME");
         readParam(execGraphPath, "OV_CPU_EXEC_GRAPH_PATH");
         readParam(verbose, "OV_CPU_VERBOSE");
+        readParam(layoutsDumpPath, "OV_CPU_LAYOUTS_DUMP_PATH");
     }
 
     std::string blobDumpDir;
@@ -37,6 +38,7 @@ public:
     std::string blobDumpNodeName;
     std::string execGraphPath;
     std::string verbose;
+    std::string layoutsDumpPath;
 
 private:
     static void readParam(std::string& param, const char* envVar) {
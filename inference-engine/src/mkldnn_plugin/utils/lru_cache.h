@@ -0,0 +1,101 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Cache with a limited number of entries which evicts the least recently used entry when the capacity is exceeded.
+ * Zero capacity means that nothing is stored, so every lookup is a miss.
+ */
+template<typename Key, typename Value, typename Hasher = std::hash<Key>>
+class LruCache {
+public:
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+    };
+
+    explicit LruCache(size_t capacity = 0) : _capacity(capacity) {}
+
+    /**
+     * @brief Returns the value stored for the key, or the one created by the builder if there is no such entry yet.
+     * Newly created value is stored in the cache.
+     */
+    template<typename Builder>
+    Value getOrCreate(const Key& key, Builder builder) {
+        auto it = _map.find(key);
+        if (it != _map.end()) {
+            _stats.hits++;
+            _list.splice(_list.begin(), _list, it->second);
+            return it->second->second;
+        }
+
+        _stats.misses++;
+        Value value = builder(key);
+        put(key, value);
+        return value;
+    }
+
+    void put(const Key& key, const Value& value) {
+        if (_capacity == 0)
+            return;
+
+        auto it = _map.find(key);
+        if (it != _map.end()) {
+            it->second->second = value;
+            _list.splice(_list.begin(), _list, it->second);
+            return;
+        }
+
+        if (_map.size() == _capacity) {
+            _map.erase(_list.back().first);
+            _list.pop_back();
+        }
+        _list.emplace_front(key, value);
+        _map.emplace(key, _list.begin());
+    }
+
+    void setCapacity(size_t capacity) {
+        _capacity = capacity;
+        while (_map.size() > _capacity) {
+            _map.erase(_list.back().first);
+            _list.pop_back();
+        }
+    }
+
+    size_t capacity() const {
+        return _capacity;
+    }
+
+    size_t size() const {
+        return _map.size();
+    }
+
+    const Statistics& statistics() const {
+        return _stats;
+    }
+
+    void clear() {
+        _map.clear();
+        _list.clear();
+    }
+
+private:
+    using Entry = std::pair<Key, Value>;
+
+    size_t _capacity;
+    std::list<Entry> _list;
+    std::unordered_map<Key, typename std::list<Entry>::iterator, Hasher> _map;
+    Statistics _stats;
+};
+
+}  // namespace MKLDNNPlugin
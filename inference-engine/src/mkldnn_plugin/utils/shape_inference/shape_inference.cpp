@@ -5,7 +5,12 @@
 #include <openvino/core/node.hpp>
 #include <ngraph/runtime/host_tensor.hpp>
 #include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset2.hpp>
+#include <openvino/opsets/opset3.hpp>
+#include <openvino/opsets/opset4.hpp>
+#include <openvino/opsets/opset5.hpp>
 #include <openvino/opsets/opset6.hpp>
+#include <openvino/opsets/opset7.hpp>
 #include <openvino/opsets/opset8.hpp>
 #include "static_shape.hpp"
 #include "shape_inference.hpp"
@@ -13,12 +18,17 @@
 #include "reduce_shape_inference.hpp"
 #include "shape_nodes.hpp"
 #include "experimental_detectron_detection_output_shape_inference.hpp"
+#include "matmul_shape_inference.hpp"
+#include "concat_shape_inference.hpp"
+#include "transpose_shape_inference.hpp"
+#include "gather_shape_inference.hpp"
 
 
-void shape_inference(ov::Node* op,
-                     const std::vector<ov::StaticShape>& input_shapes,
-                     std::vector<ov::StaticShape>& output_shapes,
-                     const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) {
+bool native_shape_inference(ov::Node* op,
+                            const std::vector<ov::StaticShape>& input_shapes,
+                            std::vector<ov::StaticShape>& output_shapes,
+                            const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) {
+    output_shapes.resize(op->get_output_size());
     if (auto node = ov::as_type<ov::opset8::Convolution>(op)) {
         ov::CoordinateDiff pads_begin, pads_end;
         bool status = resolve_auto_pad_for_shape(node, pads_begin, pads_end, input_shapes, 2, 2);
@@ -40,25 +50,66 @@ void shape_inference(ov::Node* op,
         shape_infer(node, input_shapes, output_shapes);
     } else if (auto node = ov::as_type<ov::opset6::ExperimentalDetectronDetectionOutput>(op)) {
         shape_infer(node, input_shapes, output_shapes);
+    } else if (auto node = ov::as_type<ov::op::util::BinaryElementwiseArithmetic>(op)) {
+        eltwise_shape_infer(node, input_shapes, output_shapes);
+    } else if (auto node = ov::as_type<ov::op::util::BinaryElementwiseComparison>(op)) {
+        eltwise_shape_infer(node, input_shapes, output_shapes);
+    } else if (auto node = ov::as_type<ov::op::util::BinaryElementwiseLogical>(op)) {
+        eltwise_shape_infer(node, input_shapes, output_shapes);
+    } else if (auto node = ov::as_type<ov::op::util::UnaryElementwiseArithmetic>(op)) {
+        copy_shape_infer(node, input_shapes, output_shapes);
+    } else if (ov::is_type<ov::opset1::Convert>(op) || ov::is_type<ov::opset1::Softmax>(op) ||
+               ov::is_type<ov::opset5::LogSoftmax>(op) || ov::is_type<ov::opset1::Elu>(op) ||
+               ov::is_type<ov::opset1::LogicalNot>(op) || ov::is_type<ov::opset4::Mish>(op) ||
+               ov::is_type<ov::opset4::SoftPlus>(op) || ov::is_type<ov::opset5::Round>(op) ||
+               ov::is_type<ov::opset2::Gelu>(op)) {
+        copy_shape_infer(op, input_shapes, output_shapes);
+    } else if (ov::is_type<ov::opset1::Clamp>(op) || ov::is_type<ov::opset1::PRelu>(op) ||
+               ov::is_type<ov::opset4::Swish>(op) || ov::is_type<ov::opset1::Selu>(op) ||
+               ov::is_type<ov::opset6::MVN>(op) || ov::is_type<ov::opset2::MVN>(op)) {
+        first_input_passthrough_infer(op, input_shapes, output_shapes);
+    } else if (auto node = ov::as_type<ov::opset1::MatMul>(op)) {
+        shape_infer(node, input_shapes, output_shapes);
+    } else if (auto node = ov::as_type<ov::opset1::Concat>(op)) {
+        shape_infer(node, input_shapes, output_shapes);
+    } else if (auto node = ov::as_type<ov::opset1::Transpose>(op)) {
+        shape_infer(node, input_shapes, output_shapes, constant_data);
+    } else if (auto node = ov::as_type<ov::opset1::Gather>(op)) {
+        shape_infer(node, input_shapes, output_shapes, constant_data);
+    } else if (auto node = ov::as_type<ov::opset7::Gather>(op)) {
+        shape_infer(node, input_shapes, output_shapes, constant_data);
+    } else if (auto node = ov::as_type<ov::opset8::Gather>(op)) {
+        shape_infer(node, input_shapes, output_shapes, constant_data);
     } else {
-        ngraph::OutputVector new_inputs;
-        for (size_t i = 0; i < op->get_input_size(); ++i) {
-            if (constant_data.count(i)) {
-                new_inputs.push_back(std::make_shared<ov::opset1::Constant>(constant_data.at(i)));
-            } else {
-                new_inputs.push_back(
-                        std::make_shared<ov::opset1::Parameter>(
-                                op->get_input_element_type(i), input_shapes[i].to_partial_shape()));
-            }
-        }
-        const auto local_op = op->clone_with_new_inputs(new_inputs);
-        local_op->validate_and_infer_types();
+        return false;
+    }
+    return true;
+}
 
-        output_shapes.resize(op->get_output_size());
-        for (size_t i = 0; i < output_shapes.size(); ++i) {
-            const auto &partial_shape = local_op->get_output_partial_shape(i);
-            OPENVINO_ASSERT(partial_shape.is_static(), "On device shape infer shouldn't support default shape infer for nodes with internal dynamism");
-            output_shapes[i] = ov::StaticShape(partial_shape.to_shape());
+void shape_inference(ov::Node* op,
+                     const std::vector<ov::StaticShape>& input_shapes,
+                     std::vector<ov::StaticShape>& output_shapes,
+                     const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) {
+    if (native_shape_inference(op, input_shapes, output_shapes, constant_data))
+        return;
+
+    ngraph::OutputVector new_inputs;
+    for (size_t i = 0; i < op->get_input_size(); ++i) {
+        if (constant_data.count(i)) {
+            new_inputs.push_back(std::make_shared<ov::opset1::Constant>(constant_data.at(i)));
+        } else {
+            new_inputs.push_back(
+                    std::make_shared<ov::opset1::Parameter>(
+                            op->get_input_element_type(i), input_shapes[i].to_partial_shape()));
         }
     }
+    const auto local_op = op->clone_with_new_inputs(new_inputs);
+    local_op->validate_and_infer_types();
+
+    output_shapes.resize(op->get_output_size());
+    for (size_t i = 0; i < output_shapes.size(); ++i) {
+        const auto &partial_shape = local_op->get_output_partial_shape(i);
+        OPENVINO_ASSERT(partial_shape.is_static(), "On device shape infer shouldn't support default shape infer for nodes with internal dynamism");
+        output_shapes[i] = ov::StaticShape(partial_shape.to_shape());
+    }
 }
\ No newline at end of file
@@ -9,6 +9,14 @@
 #include "static_shape.hpp"
 
 
+/**
+ * @brief Infers the output shapes using the static shape inference implemented for the operation natively
+ * @return false if there is no such implementation for the operation, output shapes are not inferred in this case
+ */
+bool native_shape_inference(ov::Node* op,
+                            const std::vector<ov::StaticShape>& input_shapes,
+                            std::vector<ov::StaticShape>& output_shapes,
+                            const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data = {});
 
 void shape_inference(ov::Node* op,
                      const std::vector<ov::StaticShape>& input_shapes,
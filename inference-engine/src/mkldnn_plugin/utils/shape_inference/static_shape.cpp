@@ -107,17 +107,14 @@ bool ov::StaticShape::broadcast_merge_into(StaticShape& dst,
         case ngraph::op::AutoBroadcastType::NONE:
             return true;
         case ngraph::op::AutoBroadcastType::NUMPY: {
-            auto dst_rank = dst.size();
-            auto src_rank = src.size();
-            auto new_rank = std::max(dst_rank, src_rank);
-            std::vector<StaticDimension> dims(new_rank);
+            // merged in place, so no allocation happens unless dst has to be extended to the src rank
+            const auto src_rank = src.size();
+            if (dst.size() < src_rank)
+                dst.insert(dst.begin(), src_rank - dst.size(), StaticDimension(1));
+            const auto offset = dst.size() - src_rank;
             bool success = true;
-            for (int64_t i = 0; i < new_rank; i++) {
-                auto dsti = i < (new_rank - dst_rank) ? StaticDimension(1) : dst[i - (new_rank - dst_rank)];
-                auto srci = i < (new_rank - src_rank) ? StaticDimension(1) : src[i - (new_rank - src_rank)];
-                success &= StaticDimension::broadcast_merge(dims[i], dsti, srci);
-            }
-            dst = StaticShape(std::move(dims));
+            for (size_t i = 0; i < src_rank; i++)
+                success &= StaticDimension::broadcast_merge(dst[offset + i], dst[offset + i], src[i]);
             return success;
         }
         case ngraph::op::AutoBroadcastType::PDPD: {
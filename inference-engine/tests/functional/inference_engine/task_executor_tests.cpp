@@ -186,6 +186,27 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+class CPUStreamsExecutorTests : public ::testing::Test {};
+
+TEST_F(CPUStreamsExecutorTests, taskOfBusyStreamIsStolenByIdleStream) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 2, 1});
+    std::promise<void> unblock;
+    auto blocked = unblock.get_future().share();
+    std::promise<void> firstDone;
+    std::promise<void> secondDone;
+    // both tasks prefer the same stream, the first one waits for the second one to be executed by the other stream
+    taskExecutor->run([&, blocked] {
+        blocked.wait();
+        firstDone.set_value();
+    }, 0);
+    taskExecutor->run([&] {
+        unblock.set_value();
+        secondDone.set_value();
+    }, 0);
+    ASSERT_EQ(std::future_status::ready, secondDone.get_future().wait_for(std::chrono::seconds(10)));
+    ASSERT_EQ(std::future_status::ready, firstDone.get_future().wait_for(std::chrono::seconds(10)));
+}
+
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
 TEST_F(StreamsExecutorConfigTest, streamsExecutorConfigReturnStrings) {
@@ -342,3 +342,44 @@ TEST_F(TransformationTestsF, TransposePreProcessing) {
         function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ relu }, ngraph::ParameterVector{ input });
     }
 }
+
+TEST_F(TransformationTestsF, TransposeEltwise) {
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 32 });
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(input, order);
+        auto mean = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 1, 3 }, { 1.f, 2.f, 3.f });
+        auto subtract = std::make_shared<ngraph::opset6::Subtract>(transpose, mean);
+        auto scale = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 1 }, { 2.f });
+        auto divide = std::make_shared<ngraph::opset6::Divide>(subtract, scale);
+        auto back_order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto back_transpose = std::make_shared<ngraph::opset6::Transpose>(divide, back_order);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ back_transpose }, ngraph::ParameterVector{ input });
+        manager.register_pass<ngraph::pass::TransposeEltwise>();
+        manager.register_pass<ngraph::pass::TransposeFuse>();
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 32 });
+        auto mean = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 3, 1, 1 }, { 1.f, 2.f, 3.f });
+        auto subtract = std::make_shared<ngraph::opset6::Subtract>(input, mean);
+        auto scale = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 1, 1, 1 }, { 2.f });
+        auto divide = std::make_shared<ngraph::opset6::Divide>(subtract, scale);
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ divide }, ngraph::ParameterVector{ input });
+    }
+}
+
+TEST_F(TransformationTestsF, TransposeEltwiseNegativeBroadcast) {
+    {
+        auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 3, 16, 1 });
+        auto order = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 2, 3, 1 });
+        auto transpose = std::make_shared<ngraph::opset6::Transpose>(input, order);
+        auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 1, 8, 1 }, { 1.f });
+        auto add = std::make_shared<ngraph::opset6::Add>(transpose, constant);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ add }, ngraph::ParameterVector{ input });
+        manager.register_pass<ngraph::pass::TransposeEltwise>();
+    }
+}
@@ -12,7 +12,10 @@ using namespace LayerTestsDefinitions;
 namespace {
 
 const std::vector<ov::Shape> inShapes_nhwc = {
-    {1, 10, 10, 1}
+    {1, 10, 10, 1},
+    // the rows are long enough to be converted by the vector kernel, with and without the tail
+    {1, 24, 64, 1},
+    {2, 24, 36, 1}
 };
 
 const std::vector<ov::element::Type> inTypes = {
@@ -4,6 +4,7 @@
 
 #include <vector>
 #include <tuple>
+#include <algorithm>
 
 #include "single_layer_tests/matrix_nms.hpp"
 #include "common_test_utils/test_constants.hpp"
@@ -78,3 +79,38 @@ const auto nmsParamsDynamic = ::testing::Combine(::testing::ValuesIn(inDynamicSh
 
 INSTANTIATE_TEST_SUITE_P(smoke_MatrixNmsLayerTest_static, MatrixNmsLayerTest, nmsParamsStatic, MatrixNmsLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MatrixNmsLayerTest_dynamic, MatrixNmsLayerTest, nmsParamsDynamic, MatrixNmsLayerTest::getTestCaseName);
+
+// Half of the boxes collapse into the same point: the IoU of two of them is NaN for the normalized boxes (0 / 0), which
+// must not be taken as the maximal IoU of a box.
+class MatrixNmsZeroAreaBoxesTest : public MatrixNmsLayerTest {
+public:
+    void generate_inputs(const std::vector<ngraph::Shape>& targetInputStaticShapes) override {
+        MatrixNmsLayerTest::generate_inputs(targetInputStaticShapes);
+        auto& boxes = inputs.at(function->inputs()[0].get_node_shared_ptr());
+        auto* boxesData = boxes.data<float>();
+        for (size_t i = 0; i < boxes.get_size(); i += 8) {
+            std::fill(boxesData + i, boxesData + i + 4, 0.5f);
+        }
+    }
+};
+
+TEST_P(MatrixNmsZeroAreaBoxesTest, CompareWithRefs) {
+    run();
+};
+
+const auto nmsParamsZeroAreaBoxes = ::testing::Combine(::testing::ValuesIn(ov::test::static_shapes_to_test_representation(inStaticShapeParams)),
+                                                       ::testing::Combine(::testing::Values(ov::element::f32),
+                                                                          ::testing::Values(ov::element::i32),
+                                                                          ::testing::Values(ov::element::f32)),
+                                                       ::testing::Values(op::v8::MatrixNms::SortResultType::SCORE),
+                                                       ::testing::Values(element::i32),
+                                                       ::testing::ValuesIn(topKParams),
+                                                       ::testing::ValuesIn(thresholdParams),
+                                                       ::testing::Values(-1),
+                                                       ::testing::ValuesIn(normalized),
+                                                       ::testing::ValuesIn(decayFunction),
+                                                       ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatrixNmsLayerTest_zeroAreaBoxes, MatrixNmsZeroAreaBoxesTest, nmsParamsZeroAreaBoxes,
+                         MatrixNmsLayerTest::getTestCaseName);
@@ -201,7 +201,8 @@ namespace fullyConnected {
 
 const auto fusingBiasFC = fusingSpecificParams{std::make_shared<postNodesMgr>(std::vector<postNodeBuilder>{
             {[](std::shared_ptr<Node> inpNode, const element::Type& ngPrc, ParameterVector& params) {
-                auto bias = builder::makeConstant(ngPrc, Shape({inpNode->get_output_shape(0).back()}), std::vector<float>{}, true);
+                auto bias = builder::makeConstant(ngPrc, Shape({static_cast<size_t>(inpNode->get_output_partial_shape(0).rbegin()->get_length())}),
+                                                  std::vector<float>{}, true);
                 return std::make_shared<opset1::Add>(inpNode, bias);
             }, "fusingBiasFC"}}), {"Add"}};
 
@@ -250,6 +251,38 @@ const auto testParams2D = ::testing::Combine(fullyConnectedParams2D,
 
 INSTANTIATE_TEST_SUITE_P(smoke_FC_2D, MatMulLayerCPUTest, testParams2D, MatMulLayerCPUTest::getTestCaseName);
 
+const std::vector<ShapeRelatedParams> IS2D_dynamic = {
+    {
+        {
+            {{-1, 120}, {{59, 120}, {1, 120}, {71, 120}, {59, 120}}},
+            {{120, 20}, {{120, 20}, {120, 20}, {120, 20}, {120, 20}}}
+        },
+        {false, false}
+    },
+    {
+        {
+            {{{1, 100}, 128}, {{17, 128}, {64, 128}, {1, 128}}},
+            {{59, 128}, {{59, 128}, {59, 128}, {59, 128}}}
+        },
+        {false, true}
+    },
+};
+
+const auto fullyConnectedParams2D_dynamic = ::testing::Combine(::testing::ValuesIn(IS2D_dynamic),
+                                                               ::testing::ValuesIn(netPRCs),
+                                                               ::testing::Values(ElementType::undefined),
+                                                               ::testing::Values(ElementType::undefined),
+                                                               ::testing::Values(helpers::InputLayerType::CONSTANT),
+                                                               ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                                               ::testing::ValuesIn(additionalConfig));
+
+const auto testParams2D_dynamic = ::testing::Combine(fullyConnectedParams2D_dynamic,
+                                                     ::testing::Values(MatMulNodeType::FullyConnected),
+                                                     ::testing::ValuesIn(fusingParamsSet2D),
+                                                     ::testing::ValuesIn(filterSpecificParams()));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FC_2D_dynamic, MatMulLayerCPUTest, testParams2D_dynamic, MatMulLayerCPUTest::getTestCaseName);
+
 const std::vector<ShapeRelatedParams> IS3D = {
     {static_shapes_to_test_representation({{1, 32, 120}, {120, 5}}), {false, false}},
     {static_shapes_to_test_representation({{1, 32, 120}, {120, 5}}), {true, false}},
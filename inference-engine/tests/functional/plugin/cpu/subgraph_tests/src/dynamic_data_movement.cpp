@@ -0,0 +1,90 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+using namespace ngraph;
+using namespace ov::test;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+// The attention like data movement executed by the native dynamic nodes, neither Transpose nor Roll falls back to
+// the reference implementation. When the shapes repeat, the Transpose kernels compiled for the shapes met before are
+// reused.
+//
+//         Param
+//           |
+//       Transpose
+//           |
+//         Roll
+//           |
+//        Softmax
+//           |
+//         Result
+//
+class DynamicDataMovementTest : public testing::WithParamInterface<InputShape>, public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InputShape>& obj) {
+        const auto& inputShape = obj.param;
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_TS=";
+        for (const auto& shape : inputShape.second) {
+            result << CommonTestUtils::vec2str(shape) << "_";
+        }
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        init_input_shapes({GetParam()});
+
+        auto params = builder::makeDynamicParams(element::f32, inputDynamicShapes);
+        // the order which isn't executed by the optimized planar kernels, so the permute kernel is compiled per shape
+        const auto order = opset1::Constant::create(element::i64, Shape{4}, {0, 2, 1, 3});
+        const auto transpose = std::make_shared<opset1::Transpose>(params[0], order);
+        const auto shift = opset1::Constant::create(element::i64, Shape{2}, {1, -2});
+        const auto axes = opset1::Constant::create(element::i64, Shape{2}, {2, 3});
+        const auto roll = std::make_shared<opset7::Roll>(transpose, shift, axes);
+        const auto softmax = std::make_shared<opset1::Softmax>(roll, 3);
+
+        function = std::make_shared<ngraph::Function>(NodeVector{softmax}, params, "DynamicDataMovement");
+    }
+
+    void checkNativeNode(const std::string& nodeType, const std::string& implType) {
+        const auto execGraph = executableNetwork.get_runtime_function();
+        ASSERT_EQ(getExecGraphNodeCount(execGraph, nodeType), 1);
+        selectedType = makeSelectedTypeStr(implType, element::f32);
+        CheckPluginRelatedResults(executableNetwork, nodeType);
+    }
+};
+
+TEST_P(DynamicDataMovementTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    ASSERT_EQ(getExecGraphNodeCount(executableNetwork.get_runtime_function(), "Reference"), 0);
+    checkNativeNode("Transpose", "unknown");
+    checkNativeNode("Roll", "ref");
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    // each shape is met once
+    {{-1, -1, 4, 16}, {{1, 8, 4, 16}, {2, 5, 4, 16}, {3, 1, 4, 16}}},
+    // the shapes alternate, so the Transpose executors are taken from the cache after the first two inferences
+    {{-1, -1, 4, 16}, {{1, 8, 4, 16}, {2, 5, 4, 16}, {1, 8, 4, 16}, {2, 5, 4, 16}, {1, 8, 4, 16}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_DynamicDataMovement, DynamicDataMovementTest, ::testing::ValuesIn(inputShapes),
+                         DynamicDataMovementTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
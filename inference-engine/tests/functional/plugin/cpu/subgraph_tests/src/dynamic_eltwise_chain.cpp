@@ -0,0 +1,56 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+using namespace ngraph;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+// The fused chain of the dynamic Eltwise node is executed by the shape agnostic kernels, one per broadcasting pattern.
+// The shapes alternate between the patterns and repeat, so the cached kernels are reused with the new dims.
+//
+//  Param0  Param1
+//      \    /
+//       Add     Param2
+//         \      /
+//         Multiply
+//            |
+//          Relu
+//            |
+//         Sigmoid
+//            |
+//          Result
+//
+class DynamicEltwiseChainTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const std::vector<InputShape> inputShapes = {
+            {{-1, -1, 32}, {{2, 5, 32}, {1, 7, 32}, {2, 5, 32}, {3, 1, 32}, {1, 7, 32}}},
+            {{1, 1, 32}, {{1, 1, 32}, {1, 1, 32}, {1, 1, 32}, {1, 1, 32}, {1, 1, 32}}},
+            {{-1, -1, -1}, {{2, 5, 1}, {1, 7, 32}, {2, 1, 1}, {3, 1, 32}, {1, 7, 1}}}
+        };
+        init_input_shapes(inputShapes);
+
+        auto params = builder::makeDynamicParams(element::f32, inputDynamicShapes);
+        const auto add = std::make_shared<opset1::Add>(params[0], params[1]);
+        const auto multiply = std::make_shared<opset1::Multiply>(add, params[2]);
+        const auto relu = std::make_shared<opset1::Relu>(multiply);
+        const auto sigmoid = std::make_shared<opset1::Sigmoid>(relu);
+
+        function = std::make_shared<ngraph::Function>(NodeVector{sigmoid}, params, "DynamicEltwiseChain");
+    }
+};
+
+TEST_F(DynamicEltwiseChainTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+} // namespace SubgraphTestsDefinitions
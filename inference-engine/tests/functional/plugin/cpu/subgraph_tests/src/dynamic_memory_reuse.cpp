@@ -0,0 +1,59 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+using namespace ngraph;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+// The output memory of the SoftMax node is reallocated only when the shape grows beyond the largest one observed before.
+// If the dimension is bounded, the memory is preallocated for the upper bound and never reallocated.
+//
+//   Param
+//     |
+//  SoftMax
+//     |
+//   Result
+//
+class DynamicMemoryReuseTest : public SubgraphBaseTest {
+protected:
+    void init(const ov::Dimension& dynamicDim) {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const InputShape inputShape = {{1, dynamicDim}, {{1, 10}, {1, 20}, {1, 10}, {1, 20}, {1, 5}}};
+        init_input_shapes({inputShape});
+
+        auto params = builder::makeDynamicParams(element::f32, inputDynamicShapes);
+        const auto softMax = std::make_shared<opset1::Softmax>(params[0], 1);
+        softMax->set_friendly_name("softmax");
+
+        function = std::make_shared<ngraph::Function>(NodeVector{softMax}, params, "DynamicMemoryReuse");
+    }
+
+    std::string getReallocationsCount() {
+        return CPUTestUtils::getExecGraphInfo(executableNetwork.get_runtime_function(), "softmax", "outputMemoryReallocations");
+    }
+};
+
+TEST_F(DynamicMemoryReuseTest, smoke_UnboundedShapeReallocatesOnGrowthOnly) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    init(ov::Dimension::dynamic());
+    run();
+    ASSERT_EQ("2", getReallocationsCount());
+}
+
+TEST_F(DynamicMemoryReuseTest, smoke_BoundedShapeIsPreallocated) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    init(ov::Dimension(1, 32));
+    run();
+    ASSERT_EQ("0", getReallocationsCount());
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,157 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <functional_test_utils/ov_tensor_utils.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+using namespace ngraph;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+// The LSTMSequence with the dynamic batch and sequence length is executed by the CPU node natively. The forward
+// sequences of the batch have different lengths, including the empty ones, and the chunk primitives are reused for
+// the repeated batch sizes. The static sequences with the lengths shorter than the sequence are executed by the same
+// chunks. The other directions take the lengths from a constant, the sequence length isn't a power of two, so the
+// sequence is split into several chunks.
+//
+//   X   H0   C0   seq_lengths
+//    \   |   |   /
+//     LSTMSequence
+//      |    |    |
+//      Y    Ho   Co
+//
+using DynamicRNNSequenceParams = std::tuple<InputShape,                         // 'X' input shape
+                                            op::RecurrentSequenceDirection>;    // Direction
+
+class DynamicRNNSequenceTest : public testing::WithParamInterface<DynamicRNNSequenceParams>, public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DynamicRNNSequenceParams>& obj) {
+        InputShape dataShape;
+        op::RecurrentSequenceDirection direction;
+        std::tie(dataShape, direction) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({dataShape.first}) << "_TS=";
+        for (const auto& shape : dataShape.second) {
+            result << CommonTestUtils::vec2str(shape) << "_";
+        }
+        result << "direction=" << direction;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape dataShape;
+        op::RecurrentSequenceDirection direction;
+        std::tie(dataShape, direction) = this->GetParam();
+
+        const size_t hiddenSize = 16;
+        const size_t numDirections = direction == op::RecurrentSequenceDirection::BIDIRECTIONAL ? 2 : 1;
+        const auto& dataPShape = dataShape.first;
+        const size_t inputSize = dataPShape[2].get_length();
+
+        InputShape stateShape {ov::PartialShape{dataPShape[0], static_cast<int64_t>(numDirections), static_cast<int64_t>(hiddenSize)}, {}};
+        InputShape seqLengthsShape {ov::PartialShape{dataPShape[0]}, {}};
+        for (const auto& shape : dataShape.second) {
+            stateShape.second.push_back({shape[0], numDirections, hiddenSize});
+            seqLengthsShape.second.push_back({shape[0]});
+        }
+
+        // the forward sequence takes the lengths at runtime, the other directions process the whole sequence
+        const bool seqLengthsParam = direction == op::RecurrentSequenceDirection::FORWARD;
+        std::vector<InputShape> inputShapes {dataShape, stateShape, stateShape};
+        if (seqLengthsParam)
+            inputShapes.push_back(seqLengthsShape);
+        init_input_shapes(inputShapes);
+
+        std::vector<element::Type> paramTypes {element::f32, element::f32, element::f32};
+        if (seqLengthsParam)
+            paramTypes.push_back(element::i32);
+        auto params = builder::makeDynamicParams(paramTypes, inputDynamicShapes);
+
+        std::shared_ptr<Node> seqLengths;
+        if (seqLengthsParam) {
+            seqLengths = params[3];
+        } else {
+            const auto& firstShape = dataShape.second.front();
+            seqLengths = builder::makeConstant<int32_t>(element::i32, {firstShape[0]},
+                                                        std::vector<int32_t>(firstShape[0], static_cast<int32_t>(firstShape[1])));
+        }
+
+        const size_t gates = 4;
+        const auto W = builder::makeConstant<float>(element::f32, {numDirections, gates * hiddenSize, inputSize}, {}, true, 1.f, -1.f);
+        const auto R = builder::makeConstant<float>(element::f32, {numDirections, gates * hiddenSize, hiddenSize}, {}, true, 1.f, -1.f);
+        const auto B = builder::makeConstant<float>(element::f32, {numDirections, gates * hiddenSize}, {}, true, 1.f, -1.f);
+        const auto lstm = std::make_shared<opset5::LSTMSequence>(params[0], params[1], params[2], seqLengths, W, R, B, hiddenSize,
+                                                                 direction);
+
+        function = std::make_shared<ngraph::Function>(lstm->outputs(), params, "DynamicRNNSequence");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); ++i) {
+            const auto& funcInput = funcInputs[i];
+            ov::runtime::Tensor tensor;
+            if (i == 3) {
+                // the lengths decrease over the batch down to the empty sequence
+                const size_t seqLength = targetInputStaticShapes[0][1];
+                tensor = ov::runtime::Tensor(funcInput.get_element_type(), targetInputStaticShapes[i]);
+                auto *dataPtr = tensor.data<int32_t>();
+                for (size_t b = 0; b < tensor.get_size(); b++)
+                    dataPtr[b] = std::max<int32_t>(static_cast<int32_t>(seqLength) - static_cast<int32_t>(3 * b), 0);
+            } else {
+                tensor = ov::test::utils::create_and_fill_tensor(funcInput.get_element_type(), targetInputStaticShapes[i], 2, -1, 100);
+            }
+            inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+        }
+    }
+};
+
+TEST_P(DynamicRNNSequenceTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+namespace {
+
+const size_t inputSize = 10;
+
+const std::vector<InputShape> forwardDataShapes = {
+    // dynamic batch and sequence length
+    {{-1, -1, inputSize}, {{2, 5, inputSize}, {3, 7, inputSize}, {1, 12, inputSize}, {2, 5, inputSize}, {3, 1, inputSize}}},
+    // the empty sequence passes the initial states through
+    {{-1, -1, inputSize}, {{2, 5, inputSize}, {2, 0, inputSize}, {3, 7, inputSize}}},
+    // static shapes, the sequence lengths are shorter than the sequence
+    {{3, 7, inputSize}, {{3, 7, inputSize}}},
+    // static shapes for which the FP32 weights would be packed for the single primitive
+    {{16, 1, inputSize}, {{16, 1, inputSize}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_DynamicRNNSequence_Forward, DynamicRNNSequenceTest,
+                         ::testing::Combine(::testing::ValuesIn(forwardDataShapes),
+                                            ::testing::Values(op::RecurrentSequenceDirection::FORWARD)),
+                         DynamicRNNSequenceTest::getTestCaseName);
+
+// the batch is defined by the constant sequence lengths, the sequence length of 5 is split into the chunks of 4 and 1
+const std::vector<InputShape> wholeSeqDataShapes = {
+    {{-1, 5, inputSize}, {{2, 5, inputSize}, {2, 5, inputSize}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_DynamicRNNSequence_WholeSeq, DynamicRNNSequenceTest,
+                         ::testing::Combine(::testing::ValuesIn(wholeSeqDataShapes),
+                                            ::testing::Values(op::RecurrentSequenceDirection::REVERSE,
+                                                              op::RecurrentSequenceDirection::BIDIRECTIONAL)),
+                         DynamicRNNSequenceTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,174 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+using namespace ngraph;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+// The sequence length of the sliced input is dynamic, so the number of iterations and the shape of the concatenated
+// output are known only at runtime. The hidden state is passed between the iterations through the back edge.
+//
+//         TensorIterator body
+//   Xi [1, 1, 8]   Hi [1, 1, 8]  <---
+//          \        /               |
+//             Add                   |
+//              |                    |
+//             Relu ------> Ho ------
+//              |
+//         concat output
+//
+class DynamicTensorIteratorTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const std::vector<InputShape> inputShapes = {
+            {{1, -1, 8}, {{1, 2, 8}, {1, 10, 8}, {1, 5, 8}, {1, 10, 8}}},
+            {{1, 1, 8}, {{1, 1, 8}, {1, 1, 8}, {1, 1, 8}, {1, 1, 8}}}
+        };
+        init_input_shapes(inputShapes);
+
+        auto params = builder::makeDynamicParams(element::f32, inputDynamicShapes);
+
+        auto xi = std::make_shared<opset6::Parameter>(element::f32, PartialShape{1, 1, 8});
+        auto hi = std::make_shared<opset6::Parameter>(element::f32, PartialShape{1, 1, 8});
+        auto add = std::make_shared<opset6::Add>(xi, hi);
+        auto relu = std::make_shared<opset6::Relu>(add);
+        auto ho = std::make_shared<opset6::Result>(relu);
+        auto body = std::make_shared<ngraph::Function>(ResultVector{ho}, ParameterVector{xi, hi});
+
+        auto tensorIterator = std::make_shared<opset6::TensorIterator>();
+        tensorIterator->set_body(body);
+        tensorIterator->set_sliced_input(xi, params[0], 0, 1, 1, -1, 1);
+        tensorIterator->set_merged_input(hi, params[1], ho);
+        auto concatOutput = tensorIterator->get_concatenated_slices(ho, 0, 1, 1, -1, 1);
+        auto lastOutput = tensorIterator->get_iter_value(ho, -1);
+
+        function = std::make_shared<ngraph::Function>(OutputVector{concatOutput, lastOutput}, params, "DynamicTensorIterator");
+    }
+};
+
+TEST_F(DynamicTensorIteratorTest, smoke_DynamicSequenceLength) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+// The trip count of the Loop is a runtime input, so the number of iterations and the shape of the concatenated output
+// are known only at runtime.
+//
+//           Loop body
+//   Xi [1, 8]   Hi [1, 8]  <---
+//          \      /           |
+//            Add               |
+//             |                |
+//            Relu ----> Ho ----
+//             |
+//       concat output
+//
+class DynamicLoopTripCountTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const std::vector<InputShape> inputShapes = {
+            {{1}, std::vector<ov::Shape>(tripCounts.size(), {1})},
+            {{1, 8}, std::vector<ov::Shape>(tripCounts.size(), {1, 8})},
+            {{1, 8}, std::vector<ov::Shape>(tripCounts.size(), {1, 8})}
+        };
+        init_input_shapes(inputShapes);
+
+        auto params = builder::makeDynamicParams({element::i64, element::f32, element::f32}, inputDynamicShapes);
+
+        auto xi = std::make_shared<opset5::Parameter>(element::f32, PartialShape{1, 8});
+        auto hi = std::make_shared<opset5::Parameter>(element::f32, PartialShape{1, 8});
+        auto add = std::make_shared<opset5::Add>(xi, hi);
+        auto relu = std::make_shared<opset5::Relu>(add);
+        auto ho = std::make_shared<opset5::Result>(relu);
+        auto condition = std::make_shared<opset5::Result>(opset5::Constant::create(element::boolean, Shape{1}, {true}));
+        auto body = std::make_shared<ngraph::Function>(ResultVector{ho, condition}, ParameterVector{xi, hi});
+
+        auto executionCondition = opset5::Constant::create(element::boolean, Shape{1}, {true});
+        auto loop = std::make_shared<opset5::Loop>(params[0], executionCondition);
+        loop->set_function(body);
+        loop->set_special_body_ports(opset5::Loop::SpecialBodyPorts{-1, 1});
+        loop->set_invariant_input(xi, params[1]);
+        loop->set_merged_input(hi, params[2], ho);
+        auto concatOutput = loop->get_concatenated_slices(ho, 0, 1, 1, -1, 0);
+        auto lastOutput = loop->get_iter_value(ho, -1);
+
+        function = std::make_shared<ngraph::Function>(OutputVector{concatOutput, lastOutput}, params, "DynamicLoopTripCount");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        SubgraphBaseTest::generate_inputs(targetInputStaticShapes);
+        auto& tripCount = inputs.at(function->get_parameters()[0]);
+        tripCount.data<int64_t>()[0] = tripCounts[inferIdx++ % tripCounts.size()];
+    }
+
+    const std::vector<int64_t> tripCounts = {3, 7, 1, 7};
+    size_t inferIdx = 0;
+};
+
+TEST_F(DynamicLoopTripCountTest, smoke_DynamicTripCount) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+// The state passed through the back edge grows on each iteration, so the shapes of the body change between the
+// iterations. The width of the input is dynamic as well.
+//
+//           Loop body
+//   Xi [1, ?]   Hi [1, ?]  <---
+//          \      /           |
+//           Concat             |
+//             |                |
+//             + ------> Ho ----
+//             |
+//        last value
+//
+class DynamicLoopBodyShapesTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const std::vector<InputShape> inputShapes = {
+            {{1, -1}, {{1, 2}, {1, 5}, {1, 2}}},
+        };
+        init_input_shapes(inputShapes);
+
+        auto params = builder::makeDynamicParams(element::f32, inputDynamicShapes);
+
+        auto xi = std::make_shared<opset5::Parameter>(element::f32, PartialShape{1, -1});
+        auto hi = std::make_shared<opset5::Parameter>(element::f32, PartialShape{1, -1});
+        auto concat = std::make_shared<opset5::Concat>(OutputVector{hi, xi}, 1);
+        auto ho = std::make_shared<opset5::Result>(concat);
+        auto condition = std::make_shared<opset5::Result>(opset5::Constant::create(element::boolean, Shape{1}, {true}));
+        auto body = std::make_shared<ngraph::Function>(ResultVector{ho, condition}, ParameterVector{xi, hi});
+
+        auto tripCount = opset5::Constant::create(element::i64, Shape{1}, {3});
+        auto executionCondition = opset5::Constant::create(element::boolean, Shape{1}, {true});
+        auto loop = std::make_shared<opset5::Loop>(tripCount, executionCondition);
+        loop->set_function(body);
+        loop->set_special_body_ports(opset5::Loop::SpecialBodyPorts{-1, 1});
+        loop->set_invariant_input(xi, params[0]);
+        loop->set_merged_input(hi, params[0], ho);
+        auto lastOutput = loop->get_iter_value(ho, -1);
+
+        function = std::make_shared<ngraph::Function>(OutputVector{lastOutput}, params, "DynamicLoopBodyShapes");
+    }
+};
+
+TEST_F(DynamicLoopBodyShapesTest, smoke_ChangingBodyShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,115 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include <ie_system_conf.h>
+
+#include <sstream>
+
+using namespace ngraph;
+using namespace ov::test;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+// The exported network is already in the CPU specific opset: MatMul with Add is FullyConnected with bias. The snippet
+// of Relu and Sigmoid must be tokenized again on import as it was on the compilation, while the prepared weights of
+// FullyConnected are restored from the exported data.
+//
+//      Param
+//        |
+//      MatMul
+//        |
+//       Add
+//        |
+//       Relu
+//        |
+//     Sigmoid
+//        |
+//      Result
+//
+class ExportImportTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // snippets are not tokenized when the graph is executed in bf16
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::NO});
+
+        const InputShape inputShape = {{}, {{2, 64}}};
+        init_input_shapes({inputShape});
+
+        auto params = builder::makeDynamicParams(element::f32, inputDynamicShapes);
+        const auto weights = builder::makeConstant<float>(element::f32, {64, 32}, {}, true);
+        const auto matMul = std::make_shared<opset1::MatMul>(params[0], weights);
+        const auto bias = builder::makeConstant<float>(element::f32, {32}, {}, true);
+        const auto add = std::make_shared<opset1::Add>(matMul, bias);
+        const auto relu = std::make_shared<opset1::Relu>(add);
+        relu->set_friendly_name(reluName);
+        const auto sigmoid = std::make_shared<opset1::Sigmoid>(relu);
+
+        function = std::make_shared<ngraph::Function>(NodeVector{sigmoid}, params, "ExportImport");
+    }
+
+    // the implementations and layouts selected on the compilation are restored on import
+    static std::map<std::string, std::string> getExecNodeTypes(const std::shared_ptr<const ov::Function>& execGraph) {
+        std::map<std::string, std::string> nodes;
+        for (const auto& node : execGraph->get_ops()) {
+            nodes[node->get_friendly_name()] = getExecGraphInfo(node, ExecGraphInfoSerialization::LAYER_TYPE) + ";" +
+                                               getExecGraphInfo(node, ExecGraphInfoSerialization::IMPL_TYPE) + ";" +
+                                               getExecGraphInfo(node, ExecGraphInfoSerialization::OUTPUT_LAYOUTS);
+        }
+        return nodes;
+    }
+
+    // Relu is fused into FullyConnected if it isn't tokenized together with Sigmoid
+    void checkReluInSnippet(const std::shared_ptr<const ov::Function>& execGraph) const {
+        if (!InferenceEngine::with_cpu_x86_avx2())
+            return;
+        ASSERT_EQ(getExecGraphNodeCount(execGraph, "Subgraph"), 1);
+        for (const auto& node : execGraph->get_ops()) {
+            if (getExecGraphInfo(node, ExecGraphInfoSerialization::LAYER_TYPE) == "Subgraph") {
+                ASSERT_NE(getExecGraphInfo(node, ExecGraphInfoSerialization::ORIGINAL_NAMES).find(reluName),
+                          std::string::npos);
+            }
+        }
+    }
+
+    static size_t getPrecomputedOutputsCount(const std::shared_ptr<const ov::Function>& execGraph) {
+        size_t count = 0;
+        for (const auto& node : execGraph->get_ops()) {
+            const auto value = getExecGraphInfo(node, "precomputedOutputs");
+            if (!value.empty())
+                count += std::stoul(value);
+        }
+        return count;
+    }
+
+    const std::string reluName = "Relu";
+};
+
+TEST_F(ExportImportTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    const auto compiledGraph = executableNetwork.get_runtime_function();
+    checkReluInSnippet(compiledGraph);
+    ASSERT_EQ(getPrecomputedOutputsCount(compiledGraph), 0);
+
+    std::stringstream blob;
+    executableNetwork.export_model(blob);
+    executableNetwork = core->import_model(blob, targetDevice, configuration);
+    infer();
+    validate();
+
+    const auto importedGraph = executableNetwork.get_runtime_function();
+    ASSERT_EQ(getExecNodeTypes(importedGraph), getExecNodeTypes(compiledGraph));
+    checkReluInSnippet(importedGraph);
+    // the weights are reordered to the layout of the inner product on the platforms with the blocked implementations
+    if (InferenceEngine::with_cpu_x86_avx2())
+        ASSERT_GT(getPrecomputedOutputsCount(importedGraph), 0);
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,64 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset8.hpp>
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+// The typical preprocessing of an image: the color conversion followed by the mean and scale normalization.
+// Convert, Subtract and Divide are fused into the ColorConvert node.
+//
+//       Param [u8]
+//           |
+//       NV12toRGB
+//           |
+//     Convert [f32]
+//           |
+//       Subtract  <-- mean [1, 1, 1, 3]
+//           |
+//        Divide   <-- scale [1, 1, 1, 3]
+//           |
+//         Result
+//
+class FuseColorConvertNormalizationTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        inPrc = InferenceEngine::Precision::U8;
+        outPrc = InferenceEngine::Precision::FP32;
+        // the rounding of the intermediate u8 result may differ from the reference one by 1, so the results may
+        // differ by one quantization step of the input divided by the smallest scale
+        abs_threshold = 1.f / 57.12f + 1e-4f;
+        // the relative comparison is skipped up to the same difference, otherwise it fails for the values close to 0
+        threshold = abs_threshold;
+
+        auto params = builder::makeParams(element::u8, {{1, 24, 64, 1}});
+        auto colorConvert = std::make_shared<opset8::NV12toRGB>(params[0]);
+        auto convert = std::make_shared<opset8::Convert>(colorConvert, element::f32);
+        auto mean = opset8::Constant::create(element::f32, Shape{1, 1, 1, 3}, {123.675f, 116.28f, 103.53f});
+        auto subtract = std::make_shared<opset8::Subtract>(convert, mean);
+        auto scale = opset8::Constant::create(element::f32, Shape{1, 1, 1, 3}, {58.395f, 57.12f, 57.375f});
+        auto divide = std::make_shared<opset8::Divide>(subtract, scale);
+
+        function = std::make_shared<ngraph::Function>(ResultVector{std::make_shared<opset8::Result>(divide)},
+                                                      params, "FuseColorConvertNormalization");
+    }
+};
+
+TEST_F(FuseColorConvertNormalizationTest, smoke_NormalizationIsFused) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "ColorConvert", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+}
+
+} // namespace SubgraphTestsDefinitions
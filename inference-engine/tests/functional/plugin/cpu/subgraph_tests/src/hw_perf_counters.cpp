@@ -0,0 +1,66 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+// The hardware performance counters are collected along with the execution time of the nodes and stored to the
+// execution graph. They are not available if perf_event is forbidden in the environment, so the test only checks
+// that the counters are consistent when they are reported.
+//
+//    Param
+//      |
+//  Convolution
+//      |
+//    Relu
+//      |
+//   Result
+//
+class HwPerfCountersTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_PERF_COUNT, InferenceEngine::PluginConfigParams::YES});
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_HW_PERF_COUNTERS,
+                              InferenceEngine::PluginConfigParams::YES});
+
+        const InputShape inputShape = {{}, {{1, 16, 32, 32}}};
+        init_input_shapes({inputShape});
+
+        auto params = builder::makeDynamicParams(element::f32, inputDynamicShapes);
+        auto conv = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+        auto relu = std::make_shared<opset1::Relu>(conv);
+
+        function = std::make_shared<ngraph::Function>(NodeVector{relu}, params, "HwPerfCounters");
+    }
+};
+
+TEST_F(HwPerfCountersTest, smoke_CountersAreReportedPerNode) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+
+    size_t reported = 0;
+    for (const auto& node : executableNetwork.get_runtime_function()->get_ops()) {
+        const auto cycles = CPUTestUtils::getExecGraphInfo(node, "hwCycles");
+        if (cycles.empty())
+            continue;
+        reported++;
+        ASSERT_GT(std::stoull(cycles), 0ull);
+        ASSERT_FALSE(CPUTestUtils::getExecGraphInfo(node, "hwInstructions").empty());
+        ASSERT_FALSE(CPUTestUtils::getExecGraphInfo(node, "hwLlcMisses").empty());
+    }
+    if (reported == 0)
+        GTEST_SKIP() << "perf_event counters are not available";
+}
+
+} // namespace SubgraphTestsDefinitions
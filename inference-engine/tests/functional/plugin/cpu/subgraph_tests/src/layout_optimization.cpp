@@ -0,0 +1,86 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace ov::test;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+// The Sigmoid selects the planar layout of the network input, while both convolutions prefer a blocked (or channels
+// last) input, so the layouts chosen by the nodes one by one need a reorder per convolution. The layout optimization
+// switches the Sigmoid to the layout of the convolutions, which leaves a single reorder on the network input.
+//
+//            Param
+//              |
+//           Sigmoid
+//           /     \
+//        Conv     Conv
+//           \     /
+//             Add
+//              |
+//            Result
+//
+class LayoutOptimizationTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // the Sigmoid must stay a separate node to be reselected
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE,
+                              InferenceEngine::PluginConfigInternalParams::DISABLE});
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_LAYOUT_OPTIMIZATION,
+                              InferenceEngine::PluginConfigParams::YES});
+
+        const InputShape inputShape = {{}, {{1, 16, 24, 24}}};
+        init_input_shapes({inputShape});
+
+        auto params = builder::makeDynamicParams(element::f32, inputDynamicShapes);
+        const auto sigmoid = std::make_shared<opset1::Sigmoid>(params[0]);
+        sigmoid->set_friendly_name(sigmoidName);
+        const auto conv1 = builder::makeConvolution(sigmoid, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                    op::PadType::EXPLICIT, 16);
+        const auto conv2 = builder::makeConvolution(sigmoid, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                    op::PadType::EXPLICIT, 16);
+        const auto add = std::make_shared<opset1::Add>(conv1, conv2);
+
+        function = std::make_shared<ngraph::Function>(NodeVector{add}, params, "LayoutOptimization");
+    }
+
+    const std::string sigmoidName = "Sigmoid";
+};
+
+TEST_F(LayoutOptimizationTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    // the convolutions take the planar input on the machines without the blocked implementations
+    if (!InferenceEngine::with_cpu_x86_sse42())
+        GTEST_SKIP() << "The blocked convolution implementations are not available";
+
+    run();
+
+    auto referenceConfig = configuration;
+    referenceConfig[InferenceEngine::PluginConfigInternalParams::KEY_CPU_LAYOUT_OPTIMIZATION] =
+        InferenceEngine::PluginConfigParams::NO;
+    auto referenceNetwork = core->compile_model(function, targetDevice, referenceConfig);
+
+    const auto optimized = executableNetwork.get_runtime_function();
+    const auto reference = referenceNetwork.get_runtime_function();
+
+    // the reorders from the Sigmoid to each convolution are replaced with the one from the network input
+    const auto referenceReorders = getExecGraphNodeCount(reference, "Reorder");
+    ASSERT_GE(referenceReorders, 2);
+    ASSERT_EQ(getExecGraphNodeCount(optimized, "Reorder"), referenceReorders - 1);
+
+    // the same Sigmoid implementation is selected, only with the layout of the convolutions
+    ASSERT_EQ(getExecGraphInfo(reference, sigmoidName, ExecGraphInfoSerialization::OUTPUT_LAYOUTS), "abcd");
+    ASSERT_NE(getExecGraphInfo(optimized, sigmoidName, ExecGraphInfoSerialization::OUTPUT_LAYOUTS), "abcd");
+    ASSERT_EQ(getExecGraphInfo(optimized, sigmoidName, ExecGraphInfoSerialization::IMPL_TYPE),
+              getExecGraphInfo(reference, sigmoidName, ExecGraphInfoSerialization::IMPL_TYPE));
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,85 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <ie_parallel.hpp>
+
+using namespace ngraph;
+using namespace ov::test;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+// Independent branches of the inception-like block are executed concurrently, while the result must stay the same.
+// The heads of the branches are on the same level of the graph, so the exec graph reports them executed concurrently.
+//
+//            Param
+//     /        |        \
+//   Conv      Conv     MaxPool
+//    |         |         |
+//   Relu     Sigmoid    Conv
+//     \        |        /
+//            Concat
+//              |
+//            Result
+//
+class ParallelBranchesTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES,
+                              InferenceEngine::PluginConfigParams::YES});
+
+        const InputShape inputShape = {{}, {{1, 16, 20, 20}}};
+        init_input_shapes({inputShape});
+
+        auto params = builder::makeDynamicParams(element::f32, inputDynamicShapes);
+        const auto conv1 = builder::makeConvolution(params[0], element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                    op::PadType::EXPLICIT, 8);
+        conv1->set_friendly_name(branchHeads[0]);
+        const auto relu = std::make_shared<opset1::Relu>(conv1);
+        const auto conv2 = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                    op::PadType::EXPLICIT, 8);
+        conv2->set_friendly_name(branchHeads[1]);
+        const auto sigmoid = std::make_shared<opset1::Sigmoid>(conv2);
+        const auto pool = std::make_shared<opset1::MaxPool>(params[0], Strides{1, 1}, Shape{1, 1}, Shape{1, 1}, Shape{3, 3});
+        pool->set_friendly_name(branchHeads[2]);
+        const auto conv3 = builder::makeConvolution(pool, element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                    op::PadType::EXPLICIT, 8);
+        const auto concat = std::make_shared<opset1::Concat>(OutputVector{relu, sigmoid, conv3}, 1);
+
+        function = std::make_shared<ngraph::Function>(NodeVector{concat}, params, "ParallelBranches");
+    }
+
+    const std::vector<std::string> branchHeads = {"Conv1", "Conv2", "MaxPool"};
+};
+
+TEST_F(ParallelBranchesTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+
+    const auto execGraph = executableNetwork.get_runtime_function();
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    // the convolutions get the same input reorders, if any, so they are on the same level
+    ASSERT_FALSE(getExecGraphInfo(execGraph, branchHeads[0], "execLevel").empty());
+    ASSERT_EQ(getExecGraphInfo(execGraph, branchHeads[0], "execLevel"), getExecGraphInfo(execGraph, branchHeads[1], "execLevel"));
+    // the number of the concurrent executions depends on the number of the inferences, only check they happened
+    for (size_t i = 0; i < 2; i++) {
+        const auto concurrentExecutions = getExecGraphInfo(execGraph, branchHeads[i], "concurrentExecutions");
+        ASSERT_FALSE(concurrentExecutions.empty()) << branchHeads[i];
+        ASSERT_GT(std::stoul(concurrentExecutions), 0) << branchHeads[i];
+    }
+#else
+    // nested parallel regions are efficiently supported by TBB only, so the branches are executed one by one
+    for (const auto& name : branchHeads) {
+        ASSERT_TRUE(getExecGraphInfo(execGraph, name, "execLevel").empty()) << name;
+    }
+#endif
+}
+
+} // namespace SubgraphTestsDefinitions
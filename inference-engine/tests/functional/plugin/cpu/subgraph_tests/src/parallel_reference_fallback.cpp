@@ -0,0 +1,94 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include <ie_parallel.hpp>
+
+using namespace ngraph;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+// Reverse has no native CPU implementation, so it is evaluated by the reference kernel. The outermost dimension
+// is not reversed, so the evaluation may be split between the threads over this dimension. The split is done only
+// for large enough tensors, the execution graph reports the way the op was evaluated on the last inference.
+//
+//   Param
+//     |
+//  Reverse
+//     |
+//   Result
+//
+using ParallelReferenceFallbackParams = std::tuple<InputShape,     // Input shape
+                                                   std::string>;   // Expected execution path
+
+class ParallelReferenceFallbackTest : public testing::WithParamInterface<ParallelReferenceFallbackParams>,
+                                      public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ParallelReferenceFallbackParams>& obj) {
+        InputShape inputShape;
+        std::string executionPath;
+        std::tie(inputShape, executionPath) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_TS=";
+        for (const auto& shape : inputShape.second) {
+            result << CommonTestUtils::vec2str(shape) << "_";
+        }
+        result << "execution=" << executionPath;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape;
+        std::tie(inputShape, executionPath) = GetParam();
+        init_input_shapes({inputShape});
+
+        auto params = builder::makeDynamicParams(element::f32, inputDynamicShapes);
+        auto axes = opset1::Constant::create(element::i64, Shape{1}, {2});
+        auto reverse = std::make_shared<opset1::Reverse>(params[0], axes, opset1::Reverse::Mode::INDEX);
+        reverse->set_friendly_name("reverse");
+
+        function = std::make_shared<ngraph::Function>(NodeVector{reverse}, params, "ParallelReferenceFallback");
+    }
+
+    std::string getRuntimeInfo(const std::string& key) {
+        return CPUTestUtils::getExecGraphInfo(executableNetwork.get_runtime_function(), "reverse", key);
+    }
+
+    std::string executionPath;
+};
+
+TEST_P(ParallelReferenceFallbackTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (executionPath == "parallel" && InferenceEngine::parallel_get_max_threads() == 1)
+        GTEST_SKIP() << "The evaluation is not split on a single thread";
+
+    run();
+    ASSERT_EQ("Reverse (opset1)", getRuntimeInfo("referenceFallback"));
+    ASSERT_EQ(executionPath, getRuntimeInfo("referenceFallbackExecution"));
+}
+
+namespace {
+
+const std::vector<ParallelReferenceFallbackParams> params = {
+    ParallelReferenceFallbackParams{{{}, {{16, 32, 32}}}, "parallel"},
+    // too small to be split between the threads
+    ParallelReferenceFallbackParams{{{}, {{4, 8, 8}}}, "sequential"},
+    // the path is chosen for the shapes of each inference, the last one is reported
+    ParallelReferenceFallbackParams{{{-1, 32, 32}, {{1, 32, 32}, {16, 32, 32}}}, "parallel"},
+    ParallelReferenceFallbackParams{{{-1, 32, 32}, {{16, 32, 32}, {1, 32, 32}}}, "sequential"},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ParallelReferenceFallback, ParallelReferenceFallbackTest, ::testing::ValuesIn(params),
+                         ParallelReferenceFallbackTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,120 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+#include <fstream>
+
+using namespace ngraph;
+using namespace ov::test;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+// The weights of the convolution reordered to the blocked layout are stored in the persistent cache on the first load
+// and are restored from it on the second one, also by a network with other names. The corrupted entries are not restored.
+//
+//   Param
+//     |
+// Convolution
+//     |
+//   Result
+//
+class PersistentWeightsCacheTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        cacheDir = "persistent_weights_cache_" + std::to_string(std::hash<std::string>{}(
+                ::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_WEIGHTS_CACHE_DIR, cacheDir});
+
+        const InputShape inputShape = {{}, {{1, 16, 10, 10}}};
+        init_input_shapes({inputShape});
+
+        auto params = builder::makeDynamicParams(element::f32, inputDynamicShapes);
+        const auto conv = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                   op::PadType::EXPLICIT, 32);
+
+        function = std::make_shared<ngraph::Function>(NodeVector{conv}, params, "PersistentWeightsCache");
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "cpuw");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    size_t getCacheHits() const {
+        size_t hits = 0;
+        for (const auto& node : executableNetwork.get_runtime_function()->get_ops()) {
+            const auto value = getExecGraphInfo(node, "persistentWeightsCacheHits");
+            if (!value.empty())
+                hits += std::stoul(value);
+        }
+        return hits;
+    }
+
+    std::string cacheDir;
+};
+
+TEST_F(PersistentWeightsCacheTest, smoke_WeightsAreRestoredFromCache) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    const auto entries = CommonTestUtils::listFilesWithExt(cacheDir, "cpuw");
+    ASSERT_FALSE(entries.empty());
+    ASSERT_EQ(getCacheHits(), 0);
+
+    // the second network is created with the data from the cache and must produce the same results
+    run();
+    ASSERT_EQ(getCacheHits(), entries.size());
+}
+
+TEST_F(PersistentWeightsCacheTest, smoke_EntriesDontDependOnNames) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    const auto entries = CommonTestUtils::listFilesWithExt(cacheDir, "cpuw");
+    ASSERT_FALSE(entries.empty());
+
+    // the entries are keyed by the content, so they are found by the same weights in a network with other names
+    function = ngraph::clone_function(*function);
+    for (const auto& op : function->get_ops()) {
+        op->set_friendly_name(op->get_friendly_name() + "_renamed");
+    }
+    functionRefs = nullptr;
+    run();
+    ASSERT_EQ(getCacheHits(), entries.size());
+    ASSERT_EQ(CommonTestUtils::listFilesWithExt(cacheDir, "cpuw").size(), entries.size());
+}
+
+TEST_F(PersistentWeightsCacheTest, smoke_CorruptedEntriesAreNotRestored) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    const auto entries = CommonTestUtils::listFilesWithExt(cacheDir, "cpuw");
+    ASSERT_FALSE(entries.empty());
+
+    // the size of the entries is kept, so only the checksum tells the data is corrupted
+    for (const auto& entry : entries) {
+        std::fstream file(entry, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekg(0, std::ios::end);
+        const auto size = static_cast<std::streamoff>(file.tellg());
+        ASSERT_GT(size, 0);
+        char value = 0;
+        file.seekg(size - 1);
+        file.read(&value, 1);
+        value = static_cast<char>(~value);
+        file.seekp(size - 1);
+        file.write(&value, 1);
+    }
+
+    run();
+    ASSERT_EQ(getCacheHits(), 0);
+}
+
+} // namespace SubgraphTestsDefinitions
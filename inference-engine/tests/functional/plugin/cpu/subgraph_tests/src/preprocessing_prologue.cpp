@@ -0,0 +1,75 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include <openvino/core/preprocess/pre_post_process.hpp>
+
+using namespace ngraph;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+// The image is resized, normalized and converted to the layout of the network by the preprocessing. The whole
+// prologue is executed by the single Interpolate node: the input Convert is dropped, the layout Transposes are
+// eliminated or merged into the Reorder and the mean/scale values are fused as post operations.
+//
+//     Param [u8, NHWC]
+//           |
+//     Convert [f32]
+//           |
+//      Interpolate
+//           |
+//       Subtract
+//           |
+//        Divide
+//           |
+//   Transpose [NCHW]
+//           |
+//      Convolution
+//           |
+//         Result
+//
+class PreprocessingPrologueTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const InputShape inputShape = {{}, {{1, 96, 128, 3}}};
+        init_input_shapes({inputShape});
+
+        auto params = builder::makeParams(element::f32, {{1, 3, 32, 48}});
+        auto conv = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+        function = std::make_shared<ngraph::Function>(ResultVector{std::make_shared<opset1::Result>(conv)},
+                                                      params, "PreprocessingPrologue");
+
+        using namespace ov::preprocess;
+        PrePostProcessor p(function);
+        p.input().tensor().set_element_type(element::u8).set_layout("NHWC").set_spatial_static_shape(96, 128);
+        p.input().preprocess().convert_element_type(element::f32)
+                              .resize(ResizeAlgorithm::RESIZE_LINEAR)
+                              .mean({123.675f, 116.28f, 103.53f})
+                              .scale({58.395f, 57.12f, 57.375f});
+        p.input().network().set_layout("NCHW");
+        function = p.build();
+    }
+
+    size_t getNodeOfTypeCount(const std::string& nodeType) {
+        return CPUTestUtils::getExecGraphNodeCount(executableNetwork.get_runtime_function(), nodeType);
+    }
+};
+
+TEST_F(PreprocessingPrologueTest, smoke_PrologueIsExecutedByInterpolate) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    ASSERT_EQ(1u, getNodeOfTypeCount("Interpolate"));
+    ASSERT_EQ(0u, getNodeOfTypeCount("Convert"));
+    ASSERT_EQ(0u, getNodeOfTypeCount("Transpose"));
+    ASSERT_EQ(0u, getNodeOfTypeCount("Eltwise"));
+}
+
+} // namespace SubgraphTestsDefinitions
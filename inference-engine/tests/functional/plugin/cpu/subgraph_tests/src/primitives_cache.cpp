@@ -0,0 +1,61 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+// The input shape alternates between two values, so the primitive of the SoftMax node is created only once per shape
+// and is taken from the node's primitives cache afterwards.
+//
+//   Param
+//     |
+//  SoftMax
+//     |
+//   Result
+//
+class PrimitivesCacheTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const InputShape inputShape = {{1, -1}, {{1, 10}, {1, 20}, {1, 10}, {1, 20}, {1, 10}}};
+        init_input_shapes({inputShape});
+
+        auto params = builder::makeDynamicParams(element::f32, inputDynamicShapes);
+        const auto softMax = std::make_shared<opset1::Softmax>(params[0], 1);
+        softMax->set_friendly_name("softmax");
+
+        function = std::make_shared<ngraph::Function>(NodeVector{softMax}, params, "PrimitivesCache");
+    }
+
+    std::string getCacheStatistics(const std::string& key) {
+        return CPUTestUtils::getExecGraphInfo(executableNetwork.get_runtime_function(), "softmax", key);
+    }
+};
+
+TEST_F(PrimitivesCacheTest, smoke_PrimitivesAreReused) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    ASSERT_EQ("2", getCacheStatistics("primitivesCacheMisses"));
+    ASSERT_EQ("3", getCacheStatistics("primitivesCacheHits"));
+}
+
+TEST_F(PrimitivesCacheTest, smoke_CacheCanBeDisabled) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY, "0"});
+    run();
+    ASSERT_EQ("5", getCacheStatistics("primitivesCacheMisses"));
+    ASSERT_EQ("0", getCacheStatistics("primitivesCacheHits"));
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,52 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <ie_system_conf.h>
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+// Add has two consumers, so it starts a snippet and both consumers are attached to it.
+// The snippet has inputs broadcasted along different axes and two outputs.
+//
+//   Param0   Param1
+//       \     /
+//         Add     Param2
+//        /   \     /
+//     Relu   Multiply
+//       |        |
+//    Result   Result
+//
+class SnippetsSubgraphWithBroadcast : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // snippets are not tokenized when the graph is executed in bf16
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::NO});
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 3, 16, 37}, {1, 3, 1, 37}, {1, 1, 16, 1}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        const auto add = builder::makeEltwise(paramOuts[0], paramOuts[1], helpers::EltwiseTypes::ADD);
+        const auto relu = std::make_shared<opset1::Relu>(add);
+        const auto mul = builder::makeEltwise(add, paramOuts[2], helpers::EltwiseTypes::MULTIPLY);
+
+        NodeVector results{relu, mul};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "SnippetsSubgraphWithBroadcast");
+    }
+};
+
+TEST_F(SnippetsSubgraphWithBroadcast, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Subgraph", InferenceEngine::with_cpu_x86_avx2() ? 1 : 0);
+}
+
+} // namespace SubgraphTestsDefinitions
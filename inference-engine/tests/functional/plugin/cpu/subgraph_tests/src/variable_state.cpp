@@ -0,0 +1,118 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include <ngraph/ngraph.hpp>
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+// The state accumulates the inputs. The requests are run alternately, so every request must keep its own state
+// while the CPU graph binds the state buffers of the running request.
+//
+//        Param  ReadValue
+//          \      /
+//            Add
+//          /     \
+//      Assign    Relu
+//                  |
+//                Result
+//
+class VariableStateTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const Shape shape{1, 64};
+        auto input = std::make_shared<opset6::Parameter>(element::f32, shape);
+        auto init = std::make_shared<opset6::Constant>(element::f32, shape, 0);
+        auto readValue = std::make_shared<opset6::ReadValue>(init, variable);
+        auto add = std::make_shared<opset6::Add>(readValue, input);
+        auto assign = std::make_shared<opset6::Assign>(add, variable);
+        auto relu = std::make_shared<opset6::Relu>(add);
+
+        function = std::make_shared<ngraph::Function>(ResultVector{std::make_shared<opset6::Result>(relu)},
+                                                      SinkVector{assign},
+                                                      ParameterVector{input},
+                                                      "VariableState");
+    }
+
+    static void infer(InferenceEngine::InferRequest& request, float inputValue) {
+        auto input = request.GetBlob(request.GetInputsInfo().begin()->first);
+        auto inputData = input->buffer().as<float*>();
+        std::fill(inputData, inputData + input->size(), inputValue);
+        request.Infer();
+    }
+
+    static void checkValues(const InferenceEngine::Blob::CPtr& blob, float expected) {
+        auto data = blob->cbuffer().as<const float*>();
+        for (size_t i = 0; i < blob->size(); i++)
+            ASSERT_EQ(expected, data[i]);
+    }
+
+    const std::shared_ptr<Variable> variable = std::make_shared<Variable>(
+            VariableInfo{PartialShape{1, 64}, element::f32, "state"});
+};
+
+TEST_F(VariableStateTest, smoke_StatesOfRequestsAreIndependent) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    auto execNet = ie->LoadNetwork(InferenceEngine::CNNNetwork(function), targetDevice);
+    auto request1 = execNet.CreateInferRequest();
+    auto request2 = execNet.CreateInferRequest();
+    const auto outputName = execNet.GetOutputsInfo().begin()->first;
+
+    infer(request1, 1.f);
+    infer(request2, 2.f);
+    infer(request1, 1.f);
+    infer(request2, 2.f);
+    infer(request1, 1.f);
+
+    checkValues(request1.GetBlob(outputName), 3.f);
+    checkValues(request1.QueryState().front().GetState(), 3.f);
+    checkValues(request2.GetBlob(outputName), 4.f);
+    checkValues(request2.QueryState().front().GetState(), 4.f);
+
+    auto state = InferenceEngine::make_shared_blob<float>(request1.QueryState().front().GetState()->getTensorDesc());
+    state->allocate();
+    std::fill(state->buffer().as<float*>(), state->buffer().as<float*>() + state->size(), 10.f);
+    request1.QueryState().front().SetState(state);
+    infer(request1, 1.f);
+    checkValues(request1.GetBlob(outputName), 11.f);
+
+    request2.QueryState().front().Reset();
+    infer(request2, 2.f);
+    checkValues(request2.GetBlob(outputName), 2.f);
+}
+
+TEST_F(VariableStateTest, smoke_StateBlobsStayValidOverInferences) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    auto execNet = ie->LoadNetwork(InferenceEngine::CNNNetwork(function), targetDevice);
+    auto request = execNet.CreateInferRequest();
+
+    // the blob is taken once and must follow the state over the inferences
+    const auto stateBlob = request.QueryState().front().GetState();
+    infer(request, 1.f);
+    checkValues(stateBlob, 1.f);
+    infer(request, 1.f);
+    checkValues(stateBlob, 2.f);
+
+    // the blob passed to SetState must keep its value
+    auto newState = InferenceEngine::make_shared_blob<float>(stateBlob->getTensorDesc());
+    newState->allocate();
+    std::fill(newState->buffer().as<float*>(), newState->buffer().as<float*>() + newState->size(), 10.f);
+    request.QueryState().front().SetState(newState);
+    checkValues(stateBlob, 10.f);
+    infer(request, 1.f);
+    infer(request, 1.f);
+    checkValues(newState, 10.f);
+    checkValues(stateBlob, 12.f);
+    checkValues(request.QueryState().front().GetState(), 12.f);
+}
+
+}  // namespace SubgraphTestsDefinitions
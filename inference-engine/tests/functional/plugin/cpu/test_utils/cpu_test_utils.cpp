@@ -348,6 +348,34 @@ void CheckNodeOfTypeCount(InferenceEngine::ExecutableNetwork &execNet, std::stri
 
     ASSERT_EQ(expectedCount, actualNodeCount) << "Unexpected count of the node type '" << nodeType << "' ";
 }
+
+std::string getExecGraphInfo(const std::shared_ptr<const ngraph::Node>& node, const std::string& key) {
+    const auto& rtInfo = node->get_rt_info();
+    auto it = rtInfo.find(key);
+    if (rtInfo.end() == it)
+        return {};
+    auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+    IE_ASSERT(nullptr != value);
+    return value->get();
+}
+
+std::string getExecGraphInfo(const std::shared_ptr<const ov::Function>& execGraph, const std::string& nodeName,
+                             const std::string& key) {
+    for (const auto& node : execGraph->get_ops()) {
+        if (node->get_friendly_name() == nodeName)
+            return getExecGraphInfo(node, key);
+    }
+    return {};
+}
+
+size_t getExecGraphNodeCount(const std::shared_ptr<const ov::Function>& execGraph, const std::string& nodeType) {
+    size_t count = 0;
+    for (const auto& node : execGraph->get_ops()) {
+        if (getExecGraphInfo(node, ExecGraphInfoSerialization::LAYER_TYPE) == nodeType)
+            count++;
+    }
+    return count;
+}
 std::vector<CPUSpecificParams> filterCPUInfoForDevice(std::vector<CPUSpecificParams> CPUParams) {
     std::vector<CPUSpecificParams> resCPUParams;
     const int selectedTypeIndex = 3;
@@ -170,4 +170,21 @@ const std::map<std::string, std::string> cpuBF16PluginConfig =
 std::vector<CPUSpecificParams> filterCPUSpecificParams(std::vector<CPUSpecificParams>& paramsVector);
 std::vector<CPUSpecificParams> filterCPUInfoForDevice(std::vector<CPUSpecificParams> CPUParams);
 void CheckNodeOfTypeCount(InferenceEngine::ExecutableNetwork &execNet, std::string nodeType, size_t expectedCount);
+
+/**
+ * @brief Returns the runtime info value of the execution graph node, or an empty string if the node doesn't have the key
+ */
+std::string getExecGraphInfo(const std::shared_ptr<const ngraph::Node>& node, const std::string& key);
+
+/**
+ * @brief Returns the runtime info value of the execution graph node with the given name, or an empty string if there is
+ * no such node or key
+ */
+std::string getExecGraphInfo(const std::shared_ptr<const ov::Function>& execGraph, const std::string& nodeName,
+                             const std::string& key);
+
+/**
+ * @brief Returns the number of the execution graph nodes of the given type
+ */
+size_t getExecGraphNodeCount(const std::shared_ptr<const ov::Function>& execGraph, const std::string& nodeType);
 } // namespace CPUTestUtils
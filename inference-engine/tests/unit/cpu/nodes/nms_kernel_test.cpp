@@ -0,0 +1,122 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "common/nms_kernel.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+using NmsKernelParams = std::tuple<
+    NmsIouType,
+    float,      // offset
+    size_t      // number of boxes
+>;
+
+class NmsKernelTest : public ::testing::TestWithParam<NmsKernelParams> {
+protected:
+    void SetUp() override {
+        std::tie(type, offset, count) = GetParam();
+        boxes.resize(count);
+        // overlapping boxes of different sizes, some of them inverted or empty
+        for (size_t i = 0; i < count; i++) {
+            const float x = static_cast<float>((i * 37) % 101);
+            const float y = static_cast<float>((i * 53) % 97);
+            const float w = static_cast<float>((i * 7) % 23) - 2.f;
+            const float h = static_cast<float>((i * 11) % 19) - 1.f;
+            boxes.x1[i] = x;
+            boxes.y1[i] = y;
+            boxes.x2[i] = x + w;
+            boxes.y2[i] = y + h;
+        }
+        iou = std::make_shared<NmsIou>(type, offset);
+        for (size_t i = 0; i < count; i++) {
+            boxes.area[i] = iou->area(boxes.x1[i], boxes.y1[i], boxes.x2[i], boxes.y2[i]);
+        }
+    }
+
+    NmsIouType type;
+    float offset;
+    size_t count;
+    NmsBoxesSoA boxes;
+    std::shared_ptr<NmsIou> iou;
+};
+
+TEST_P(NmsKernelTest, ComputeMatchesScalar) {
+    std::vector<float> values(count);
+    for (size_t i = 0; i < count; i += 7) {
+        iou->compute(boxes, i, count, values.data());
+        for (size_t j = 0; j < count; j++) {
+            // the degenerate boxes of MatrixNms may give 0/0
+            const float expected = iou->iou(boxes, i, j);
+            ASSERT_TRUE(expected == values[j] || (std::isnan(expected) && std::isnan(values[j])))
+                << "boxes " << i << " and " << j << ": " << expected << " vs " << values[j];
+        }
+    }
+}
+
+TEST_P(NmsKernelTest, SuppressMatchesScalar) {
+    const float threshold = 0.3f;
+    for (size_t i = 0; i < count; i += 5) {
+        std::vector<uint64_t> mask(boxes.x1.size() / NmsBoxesSoA::block, 0);
+        iou->suppress(boxes, i, i + 1, count, threshold, mask.data());
+        for (size_t j = i + 1; j < count; j++) {
+            const bool suppressed = (mask[j / NmsBoxesSoA::block] >> (j % NmsBoxesSoA::block)) & 1;
+            ASSERT_EQ(iou->iou(boxes, i, j) >= threshold, suppressed) << "boxes " << i << " and " << j;
+        }
+    }
+}
+
+TEST_P(NmsKernelTest, GreedySelectionMatchesNaive) {
+    const float threshold = 0.4f;
+    std::vector<NmsCandidate> candidates;
+    for (size_t i = 0; i < count; i++) {
+        candidates.push_back({static_cast<float>((i * 31) % 17), static_cast<int>(i)});
+    }
+
+    auto sorted = candidates;
+    std::stable_sort(sorted.begin(), sorted.end(), [](const NmsCandidate& l, const NmsCandidate& r) {
+        return l.score > r.score;
+    });
+    std::vector<int> expected;
+    const size_t maxOutputs = count / 3 + 1;
+    for (const auto& candidate : sorted) {
+        if (expected.size() == maxOutputs)
+            break;
+        bool isSelected = true;
+        for (auto idx : expected) {
+            if (iou->iou(boxes, candidate.idx, idx) >= threshold) {
+                isSelected = false;
+                break;
+            }
+        }
+        if (isSelected)
+            expected.push_back(candidate.idx);
+    }
+
+    auto loadBox = [&](int idx, float& x1, float& y1, float& x2, float& y2) {
+        x1 = boxes.x1[idx];
+        y1 = boxes.y1[idx];
+        x2 = boxes.x2[idx];
+        y2 = boxes.y2[idx];
+    };
+    std::vector<NmsCandidate> selected;
+    nmsSelectGreedy(candidates, candidates.size(), maxOutputs, threshold, *iou, loadBox, selected);
+
+    ASSERT_EQ(expected.size(), selected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(expected[i], selected[i].idx) << "at " << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_NmsKernel, NmsKernelTest,
+                         ::testing::Combine(::testing::Values(NmsIouType::Clamped, NmsIouType::Matrix),
+                                            ::testing::Values(0.f, 1.f),
+                                            ::testing::Values(1, 13, 64, 200, 1500)));
+
+} // namespace
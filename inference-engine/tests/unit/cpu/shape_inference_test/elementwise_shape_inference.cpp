@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/op/add.hpp>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/relu.hpp>
+#include <openvino/op/softmax.hpp>
+#include <utils/shape_inference/shape_inference.hpp>
+#include <utils/shape_inference/static_shape.hpp>
+
+using namespace ov;
+
+TEST(StaticShapeInferenceTest, AddNumpyBroadcastTest) {
+    auto A = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1, -1});
+    auto B = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1});
+
+    auto add = std::make_shared<op::v1::Add>(A, B);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 1, 5, 1}, StaticShape{3, 8}},
+            static_output_shapes = {StaticShape{}};
+    shape_inference(add.get(), static_input_shapes, static_output_shapes);
+
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 1, 5, 8}));
+}
+
+TEST(StaticShapeInferenceTest, AddNoBroadcastTest) {
+    auto A = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1});
+    auto B = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1});
+
+    auto add = std::make_shared<op::v1::Add>(A, B, op::AutoBroadcastType::NONE);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{3, 8}, StaticShape{3, 1}},
+            static_output_shapes = {StaticShape{}};
+    ASSERT_THROW(shape_inference(add.get(), static_input_shapes, static_output_shapes), ov::NodeValidationFailure);
+}
+
+TEST(StaticShapeInferenceTest, UnaryTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+
+    auto relu = std::make_shared<op::v0::Relu>(data);
+    auto softmax = std::make_shared<op::v1::Softmax>(data, 2);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3, 4}},
+            static_output_shapes = {StaticShape{}};
+    shape_inference(relu.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 3, 4}));
+
+    shape_inference(softmax.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 3, 4}));
+}
@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/op/constant.hpp>
+#include <openvino/op/gather.hpp>
+#include <openvino/op/parameter.hpp>
+#include <utils/shape_inference/shape_inference.hpp>
+#include <utils/shape_inference/static_shape.hpp>
+
+using namespace ov;
+
+TEST(StaticShapeInferenceTest, GatherV1Test) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto indices = std::make_shared<op::v0::Parameter>(element::i32, PartialShape{-1, -1});
+    auto axis = std::make_shared<op::v0::Constant>(element::i32, Shape{1}, std::vector<int32_t>{-2});
+
+    auto gather = std::make_shared<op::v1::Gather>(data, indices, axis);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{3, 10, 7}, StaticShape{2, 5}, StaticShape{1}},
+            static_output_shapes = {StaticShape{}};
+    shape_inference(gather.get(), static_input_shapes, static_output_shapes);
+
+    ASSERT_EQ(static_output_shapes[0], StaticShape({3, 2, 5, 7}));
+}
+
+TEST(StaticShapeInferenceTest, GatherV8BatchDimsTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto indices = std::make_shared<op::v0::Parameter>(element::i32, PartialShape{-1, -1});
+    auto axis = std::make_shared<op::v0::Constant>(element::i32, Shape{}, std::vector<int32_t>{2});
+
+    auto gather = std::make_shared<op::v8::Gather>(data, indices, axis, 1);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{3, 10, 7}, StaticShape{3, 5}, StaticShape{}},
+            static_output_shapes = {StaticShape{}};
+    shape_inference(gather.get(), static_input_shapes, static_output_shapes);
+
+    ASSERT_EQ(static_output_shapes[0], StaticShape({3, 10, 5}));
+}
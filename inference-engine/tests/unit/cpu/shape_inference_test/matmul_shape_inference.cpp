@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/op/matmul.hpp>
+#include <openvino/op/parameter.hpp>
+#include <utils/shape_inference/shape_inference.hpp>
+#include <utils/shape_inference/static_shape.hpp>
+
+using namespace ov;
+
+TEST(StaticShapeInferenceTest, MatMulTest) {
+    auto A = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1, -1});
+    auto B = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+
+    auto matmul = std::make_shared<op::v0::MatMul>(A, B, false, false);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 1, 5, 16}, StaticShape{3, 16, 8}},
+            static_output_shapes = {StaticShape{}};
+    shape_inference(matmul.get(), static_input_shapes, static_output_shapes);
+
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 3, 5, 8}));
+}
+
+TEST(StaticShapeInferenceTest, MatMulTransposedTest) {
+    auto A = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto B = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1});
+
+    auto matmul = std::make_shared<op::v0::MatMul>(A, B, true, true);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{4, 16, 5}, StaticShape{8, 16}},
+            static_output_shapes = {StaticShape{}};
+    shape_inference(matmul.get(), static_input_shapes, static_output_shapes);
+
+    ASSERT_EQ(static_output_shapes[0], StaticShape({4, 5, 8}));
+}
+
+TEST(StaticShapeInferenceTest, MatMulVectorTest) {
+    auto A = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1});
+    auto B = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+
+    auto matmul = std::make_shared<op::v0::MatMul>(A, B, false, false);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{16}, StaticShape{3, 16, 8}},
+            static_output_shapes = {StaticShape{}};
+    shape_inference(matmul.get(), static_input_shapes, static_output_shapes);
+
+    ASSERT_EQ(static_output_shapes[0], StaticShape({3, 8}));
+}
+
+TEST(StaticShapeInferenceTest, MatMulIncompatibleTest) {
+    auto A = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1});
+    auto B = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1});
+
+    auto matmul = std::make_shared<op::v0::MatMul>(A, B, false, false);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{5, 16}, StaticShape{15, 8}},
+            static_output_shapes = {StaticShape{}};
+    ASSERT_THROW(shape_inference(matmul.get(), static_input_shapes, static_output_shapes), ov::NodeValidationFailure);
+}
@@ -11,6 +11,8 @@
 #include <openvino/op/parameter.hpp>
 #include <openvino/op/constant.hpp>
 #include <openvino/op/shape_of.hpp>
+#include <openvino/op/transpose.hpp>
+#include <openvino/op/concat.hpp>
 #include <utils/shape_inference/shape_inference.hpp>
 #include <utils/shape_inference/static_shape.hpp>
 
@@ -84,3 +86,31 @@ TEST(StaticShapeInferenceTest, ShapeOf0DTest) {
 
     ASSERT_EQ(static_output_shapes[0], StaticShape({}));
 }
+
+TEST(StaticShapeInferenceTest, TransposeTest) {
+    auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1, -1});
+    auto order = std::make_shared<ov::op::v0::Constant>(element::i64, Shape{4}, std::vector<int64_t>{0, 2, 1, 3});
+
+    auto transpose =
+            std::make_shared<op::v1::Transpose>(data, order);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{1, 128, 12, 64}, StaticShape{4}},
+            static_output_shapes = {StaticShape{}};
+    shape_inference(transpose.get(), static_input_shapes, static_output_shapes);
+
+    ASSERT_EQ(static_output_shapes[0], StaticShape({1, 12, 128, 64}));
+}
+
+TEST(StaticShapeInferenceTest, ConcatTest) {
+    auto A = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto B = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+
+    auto concat =
+            std::make_shared<op::v0::Concat>(OutputVector{A, B}, -2);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3, 4}, StaticShape{2, 5, 4}},
+            static_output_shapes = {StaticShape{}};
+    shape_inference(concat.get(), static_input_shapes, static_output_shapes);
+
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 8, 4}));
+}
@@ -0,0 +1,384 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "runtime/floatmath.h"
+#include "runtime/cnn.h"
+#include "runtime/pwl.h"
+
+// The primitives of the software runtime are compared with the plain scalar loops they replace. The sizes are chosen
+// so that both the single threaded and the parallel paths are taken.
+
+namespace {
+
+using SgemmDims = std::tuple<
+    int,    // M - number of rows of A and C
+    int,    // N - number of columns of B and C
+    int     // K - number of columns of A and rows of B
+>;
+
+std::vector<float> generate(size_t size, float seed) {
+    std::vector<float> data(size);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = static_cast<float>((i * 7 + static_cast<size_t>(seed)) % 13) / 13.f - 0.5f;
+    }
+    return data;
+}
+
+void compare(const std::vector<float>& expected, const std::vector<float>& actual, float threshold) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_NEAR(expected[i], actual[i], threshold) << "at " << i;
+    }
+}
+
+class GnaFloatMathSgemmTest : public ::testing::TestWithParam<SgemmDims> {};
+
+TEST_P(GnaFloatMathSgemmTest, MatchesNaiveProduct) {
+    int M, N, K;
+    std::tie(M, N, K) = GetParam();
+
+    const auto A = generate(M * K, 1);
+    const auto B = generate(K * N, 5);
+    auto C = generate(M * N, 3);
+
+    std::vector<float> expected(C);
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            for (int k = 0; k < K; k++) {
+                expected[i * N + j] += A[i * K + k] * B[k * N + j];
+            }
+        }
+    }
+
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), K, B.data(), N, 1.0f, C.data(), N);
+    compare(expected, C, 1e-4f * K);
+}
+
+// C = beta * C + alpha * A * B^T
+TEST_P(GnaFloatMathSgemmTest, TransposedBMatchesNaiveProduct) {
+    int M, N, K;
+    std::tie(M, N, K) = GetParam();
+    const float alpha = 0.5f, beta = 2.0f;
+
+    const auto A = generate(M * K, 1);
+    const auto B = generate(N * K, 5);
+    auto C = generate(M * N, 3);
+
+    std::vector<float> expected(C);
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            float sum = beta * expected[i * N + j];
+            for (int k = 0; k < K; k++) {
+                sum += alpha * A[i * K + k] * B[j * K + k];
+            }
+            expected[i * N + j] = sum;
+        }
+    }
+
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasTrans, M, N, K, alpha, A.data(), K, B.data(), K, beta, C.data(), N);
+    compare(expected, C, 1e-4f * K);
+}
+
+// C = A^T * B, C is accumulated only if beta is 1
+TEST_P(GnaFloatMathSgemmTest, TransposedAMatchesNaiveProduct) {
+    int M, N, K;
+    std::tie(M, N, K) = GetParam();
+
+    const auto A = generate(K * M, 1);
+    const auto B = generate(K * N, 5);
+    for (const float beta : {0.0f, 1.0f}) {
+        auto C = generate(M * N, 3);
+        std::vector<float> expected(C);
+        for (int i = 0; i < M; i++) {
+            for (int j = 0; j < N; j++) {
+                float sum = (beta == 1.0f) ? expected[i * N + j] : 0.0f;
+                for (int k = 0; k < K; k++) {
+                    sum += A[k * M + i] * B[k * N + j];
+                }
+                expected[i * N + j] = sum;
+            }
+        }
+
+        cblas_sgemm1(CblasRowMajor, CblasTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), M, B.data(), N, beta, C.data(), N);
+        compare(expected, C, 1e-4f * K);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_GnaFloatMath, GnaFloatMathSgemmTest,
+                         ::testing::Values(SgemmDims{1, 1, 1},
+                                           SgemmDims{7, 3, 5},
+                                           SgemmDims{70, 1, 37},
+                                           SgemmDims{129, 8, 264},
+                                           SgemmDims{512, 5, 441}));
+
+// the rows of C are the products of the listed rows of A, C is accumulated only if beta is 1
+TEST(GnaFloatMathTest, SgemmSubsetMatchesNaiveProduct) {
+    const int M = 40, N = 24, K = 300;
+    const std::vector<uint32_t> outputList = {39, 0, 7, 7, 21, 3, 38, 12, 1, 30};
+    const int L = static_cast<int>(outputList.size());
+
+    const auto A = generate(M * K, 1);
+    const auto B = generate(K * N, 5);
+    for (const float beta : {0.0f, 1.0f}) {
+        auto C = generate(L * N, 3);
+        std::vector<float> expected(C);
+        for (int l = 0; l < L; l++) {
+            const auto i = outputList[l];
+            for (int j = 0; j < N; j++) {
+                float sum = (beta == 1.0f) ? expected[l * N + j] : 0.0f;
+                for (int k = 0; k < K; k++) {
+                    sum += A[i * K + k] * B[k * N + j];
+                }
+                expected[l * N + j] = sum;
+            }
+        }
+
+        cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, L, N, K, 1.0f, A.data(), K, B.data(), N, beta,
+                           C.data(), N, outputList.data(), L);
+        compare(expected, C, 1e-4f * K);
+    }
+}
+
+// the columns of C are the products with the listed rows of B
+TEST(GnaFloatMathTest, SgemmSubsetTransposedBMatchesNaiveProduct) {
+    const int M = 6, N = 40, K = 33;
+    const std::vector<uint32_t> outputList = {39, 0, 7, 21, 3};
+    const int L = static_cast<int>(outputList.size());
+    const float alpha = 0.5f, beta = 2.0f;
+
+    const auto A = generate(M * K, 1);
+    const auto B = generate(N * K, 5);
+    auto C = generate(M * L, 3);
+    std::vector<float> expected(C);
+    for (int i = 0; i < M; i++) {
+        for (int l = 0; l < L; l++) {
+            const auto j = outputList[l];
+            float sum = beta * expected[i * L + l];
+            for (int k = 0; k < K; k++) {
+                sum += alpha * A[i * K + k] * B[j * K + k];
+            }
+            expected[i * L + l] = sum;
+        }
+    }
+
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasTrans, M, N, K, alpha, A.data(), K, B.data(), K, beta,
+                       C.data(), L, outputList.data(), L);
+    compare(expected, C, 1e-4f * K);
+}
+
+TEST(GnaFloatMathTest, SgemvSplitMatchesNaiveProduct) {
+    const uint32_t N = 300, K1 = 41, K2 = 70;
+
+    const auto A1 = generate(K1, 1);
+    const auto A2 = generate(K2, 2);
+    const auto X = generate(N * (K1 + K2), 3);
+    const auto B = generate(N, 4);
+    std::vector<float> C(N);
+
+    sgemv_split(N, K1, K2, A1.data(), A2.data(), X.data(), B.data(), C.data());
+    for (uint32_t i = 0; i < N; i++) {
+        float expected = B[i];
+        for (uint32_t k = 0; k < K1; k++) {
+            expected += A1[k] * X[i * (K1 + K2) + k];
+        }
+        for (uint32_t k = 0; k < K2; k++) {
+            expected += A2[k] * X[i * (K1 + K2) + K1 + k];
+        }
+        ASSERT_NEAR(expected, C[i], 1e-3f) << "at " << i;
+    }
+}
+
+using CNN1DParams = std::tuple<
+    uint32_t,   // number of inputs
+    uint32_t,   // number of filters
+    uint32_t,   // filter size
+    uint32_t    // stride
+>;
+
+class GnaFloatMathCNNFilter32Test : public ::testing::TestWithParam<CNN1DParams> {};
+
+TEST_P(GnaFloatMathCNNFilter32Test, MatchesNaiveConvolution) {
+    uint32_t numInputs, numFilters, filterSize, stride;
+    std::tie(numInputs, numFilters, filterSize, stride) = GetParam();
+    const uint32_t numOutputsPerFilter = (numInputs - filterSize) / stride + 1;
+
+    auto input = generate(numInputs, 1);
+    auto filters = generate(numFilters * filterSize, 2);
+    auto biases = generate(numFilters, 3);
+    std::vector<float> output(numOutputsPerFilter * numFilters);
+
+    // the outputs of the filters are interleaved
+    std::vector<float> expected(output.size());
+    for (uint32_t j = 0; j < numOutputsPerFilter; j++) {
+        for (uint32_t i = 0; i < numFilters; i++) {
+            float sum = biases[i];
+            for (uint32_t k = 0; k < filterSize; k++) {
+                sum += input[j * stride + k] * filters[i * filterSize + k];
+            }
+            expected[j * numFilters + i] = sum;
+        }
+    }
+
+    intel_dnn_component_t component{};
+    component.num_rows_in = 1;
+    component.num_columns_in = numInputs;
+    component.num_rows_out = 1;
+    component.num_columns_out = static_cast<uint32_t>(output.size());
+    component.op.conv1D.num_filters = numFilters;
+    component.op.conv1D.num_filter_coefficients = filterSize;
+    component.op.conv1D.convStride = stride;
+    component.op.conv1D.ptr_filters = filters.data();
+    component.op.conv1D.ptr_biases = biases.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    component.original_layer_name = "conv1d";
+
+    CNNFilter32(&component);
+    compare(expected, output, 1e-4f * filterSize);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_GnaFloatMath, GnaFloatMathCNNFilter32Test,
+                         ::testing::Values(CNN1DParams{8, 1, 8, 1},
+                                           CNN1DParams{37, 3, 5, 2},
+                                           CNN1DParams{40, 8, 8, 8},
+                                           CNN1DParams{1000, 16, 48, 3}));
+
+#if GNA_LIB_VER == 2
+
+using CNN2DParams = std::tuple<
+    std::vector<uint32_t>,  // input H, W, C
+    std::vector<uint32_t>,  // kernel H, W and number of filters
+    std::vector<uint32_t>,  // stride H, W
+    std::vector<uint32_t>   // padding H, W
+>;
+
+class GnaFloatMathCNN2DFilter32Test : public ::testing::TestWithParam<CNN2DParams> {};
+
+TEST_P(GnaFloatMathCNN2DFilter32Test, MatchesNaiveConvolution) {
+    std::vector<uint32_t> inputHWC, kernel, stride, padding;
+    std::tie(inputHWC, kernel, stride, padding) = GetParam();
+    const uint32_t IH = inputHWC[0], IW = inputHWC[1], IC = inputHWC[2];
+    const uint32_t KH = kernel[0], KW = kernel[1], OC = kernel[2];
+    const uint32_t OH = (IH + 2 * padding[0] - KH) / stride[0] + 1;
+    const uint32_t OW = (IW + 2 * padding[1] - KW) / stride[1] + 1;
+    // each filter is padded to 16 bytes
+    const uint32_t kernelStride = (KH * KW * IC + 3) / 4 * 4;
+
+    auto input = generate(IH * IW * IC, 1);
+    auto filters = generate(OC * kernelStride, 2);
+    auto biases = generate(OC, 3);
+    std::vector<float> output(OH * OW * OC);
+
+    // NHWC, the zero padded area contributes nothing
+    std::vector<float> expected(output.size());
+    for (uint32_t oh = 0; oh < OH; oh++) {
+        for (uint32_t ow = 0; ow < OW; ow++) {
+            for (uint32_t oc = 0; oc < OC; oc++) {
+                float sum = biases[oc];
+                for (uint32_t kh = 0; kh < KH; kh++) {
+                    for (uint32_t kw = 0; kw < KW; kw++) {
+                        const int64_t ih = static_cast<int64_t>(oh * stride[0] + kh) - padding[0];
+                        const int64_t iw = static_cast<int64_t>(ow * stride[1] + kw) - padding[1];
+                        if (ih < 0 || ih >= IH || iw < 0 || iw >= IW) {
+                            continue;
+                        }
+                        for (uint32_t c = 0; c < IC; c++) {
+                            sum += input[(ih * IW + iw) * IC + c] * filters[oc * kernelStride + (kh * KW + kw) * IC + c];
+                        }
+                    }
+                }
+                expected[(oh * OW + ow) * OC + oc] = sum;
+            }
+        }
+    }
+
+    intel_dnn_component_t component{};
+    component.tensors = {
+        {{1, IH, IW, IC}, OvGnaTypeInt32, OvGnaModeDefault},
+        {{1, OH, OW, OC}, OvGnaTypeInt32, OvGnaModeDefault},
+        {{OC, KH, KW, IC}, OvGnaTypeInt32, OvGnaModeDefault},
+    };
+    component.op.conv2D.convStride = {stride[0], stride[1]};
+    component.op.conv2D.zeroPadding = {padding[0], padding[1]};
+    component.op.conv2D.ptr_filters = filters.data();
+    component.op.conv2D.ptr_biases = biases.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    component.original_layer_name = "conv2d";
+
+    CNN2DFilter32(&component);
+    compare(expected, output, 1e-4f * KH * KW * IC);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_GnaFloatMath, GnaFloatMathCNN2DFilter32Test,
+                         ::testing::Values(
+                             // no padding, all the columns are computed by the sliding windows
+                             CNN2DParams{{6, 8, 4}, {3, 3, 8}, {1, 1}, {0, 0}},
+                             // the first and the last columns overlap the padding
+                             CNN2DParams{{5, 7, 3}, {3, 3, 4}, {2, 2}, {1, 1}},
+                             // the stride skips a part of the right border
+                             CNN2DParams{{9, 10, 2}, {2, 3, 5}, {3, 2}, {1, 1}},
+                             // the padding is wider than the stride, so several columns on each side are borders
+                             CNN2DParams{{7, 9, 3}, {5, 5, 2}, {1, 1}, {2, 2}},
+                             // the image is narrower than the filter, all the columns are borders
+                             CNN2DParams{{4, 2, 3}, {3, 3, 2}, {1, 1}, {1, 1}},
+                             // large enough to split the rows between the threads
+                             CNN2DParams{{32, 32, 16}, {3, 3, 16}, {1, 1}, {1, 1}}));
+
+#endif
+
+using PwlParams = std::tuple<
+    DnnActivationType,
+    uint32_t,   // number of rows
+    uint32_t    // number of columns
+>;
+
+class GnaFloatMathPwlApply32Test : public ::testing::TestWithParam<PwlParams> {};
+
+// The rows of a block are split between the threads, or the columns if the block has a single row. The elements out
+// of the block must stay untouched.
+TEST_P(GnaFloatMathPwlApply32Test, MatchesNaiveActivation) {
+    DnnActivationType type;
+    uint32_t rows, columns;
+    std::tie(type, rows, columns) = GetParam();
+    const float negativeSlope = 0.1f;
+    const float untouched = -100.f;
+
+    const auto input = generate(rows * columns, 1);
+    std::vector<float> output(input.size(), untouched);
+
+    intel_dnn_component_t component{};
+    component.num_rows_in = rows;
+    component.num_columns_in = columns;
+    component.op.pwl.func_id.type = type;
+    component.op.pwl.func_id.args.lrelu.negative_slope = negativeSlope;
+    component.ptr_inputs = const_cast<float*>(input.data());
+    component.ptr_outputs = output.data();
+
+    const uint32_t rowStart = rows > 1 ? 1 : 0, rowEnd = rows > 1 ? rows - 2 : 0;
+    const uint32_t colStart = 3, colEnd = columns - 2;
+    std::vector<float> expected(output);
+    for (uint32_t i = rowStart; i <= rowEnd; i++) {
+        for (uint32_t j = colStart; j <= colEnd; j++) {
+            const float x = input[i * columns + j];
+            expected[i * columns + j] = type == kActSigmoid ? 0.5f * (1.0f + std::tanh(0.5f * x))
+                                                            : (x < 0.0f ? x * negativeSlope : x);
+        }
+    }
+
+    PwlApply32(&component, rowStart, rowEnd, colStart, colEnd);
+    compare(expected, output, 1e-6f);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_GnaFloatMath, GnaFloatMathPwlApply32Test,
+                         ::testing::Combine(::testing::Values(kActSigmoid, kActRelu),
+                                            ::testing::Values(1, 3, 130),
+                                            ::testing::Values(8, 1000, 40000)));
+
+} // namespace
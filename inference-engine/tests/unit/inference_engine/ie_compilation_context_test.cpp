@@ -10,9 +10,11 @@
 
 #include "compilation_context.hpp"
 #include "ngraph/function.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "openvino/core/preprocess/pre_post_process.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 #include "cpp/ie_cnn_network.h"
@@ -119,6 +121,20 @@ TEST_F(NetworkContext_CalcFileInfoTests, SizeModified) {
     ASSERT_NE(info1, info2);
 }
 
+TEST_F(NetworkContext_CalcFileInfoTests, WeightsOfIRModified) {
+    auto xmlName = m_fileName + ".xml";
+    auto binName = m_fileName + ".bin";
+    FileGuard xmlGuard(xmlName);
+    FileGuard binGuard(binName);
+    createFile(xmlName);
+    createFile(binName, 1);
+    auto info1 = NetworkCompilationContext::calculateFileInfo(xmlName);
+    createFile(binName, 2);
+    auto info2 = NetworkCompilationContext::calculateFileInfo(xmlName);
+    ASSERT_NE(info1, info2);
+    ASSERT_EQ(info2, NetworkCompilationContext::calculateFileInfo(xmlName, binName));
+}
+
 ////////////////////////////////////////////////////
 
 static std::shared_ptr<ngraph::Function> create_simple_function() {
@@ -152,6 +168,17 @@ static CNNNetwork createNetwork() {
     return res;
 }
 
+static CNNNetwork createNetworkWithOtherConstant() {
+    auto fun = create_simple_function();
+    for (const auto& op : fun->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(op)) {
+            ngraph::replace_node(constant, ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1}, {5}));
+            break;
+        }
+    }
+    return CNNNetwork(fun);
+}
+
 static CNNNetwork createNetworkWithLayout(const ov::Layout& layout) {
     auto fun = create_simple_function();
     fun->get_parameters()[0]->set_layout(layout);
@@ -398,6 +425,75 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstants) {
+    auto net1 = createNetwork();
+    auto net2 = createNetworkWithOtherConstant();
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashOfBigConstants) {
+    // constants bigger than the hashing block are hashed by several threads
+    auto createBigNetwork = [](int8_t lastValue) {
+        std::vector<int8_t> values(64 * 1024 * 1024 + 3, 1);
+        values.back() = lastValue;
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::i8, ngraph::Shape{values.size()});
+        auto constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{values.size()}, values);
+        auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+        auto res = std::make_shared<ngraph::opset6::Result>(add);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+    };
+    auto net1 = createBigNetwork(1);
+    auto net2 = createBigNetwork(1);
+    auto net3 = createBigNetwork(2);
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashSkipWeightsHashing) {
+    auto setFileInfo = [](CNNNetwork& net, const std::string& info) {
+        NetworkCompilationContext::setFileInfo(net, info);
+    };
+    auto net1 = createNetwork();
+    auto net2 = createNetworkWithOtherConstant();
+
+    // without the file info constants are hashed anyway
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}, true),
+              NetworkCompilationContext::computeHash(net2, {}, true));
+
+    setFileInfo(net1, "info");
+    setFileInfo(net2, "info");
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}, true),
+              NetworkCompilationContext::computeHash(net2, {}, true));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+
+    setFileInfo(net2, "info2");
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}, true),
+              NetworkCompilationContext::computeHash(net2, {}, true));
+}
+
+TEST(NetworkContext_CNNNetwork, HashSkipWeightsHashingWithPreprocessing) {
+    auto createNetworkWithMean = [](float mean) {
+        CNNNetwork net(create_simple_function());
+        // the constants of the read network are identified by the file info, the preprocessing ones are added later
+        NetworkCompilationContext::setFileInfo(net, "info");
+        auto p = ov::preprocess::PrePostProcessor(net.getFunction());
+        p.input().tensor().set_element_type(ov::element::f32);
+        p.input().preprocess().mean(mean).convert_element_type(ov::element::i8);
+        return CNNNetwork(p.build());
+    };
+    auto net1 = createNetworkWithMean(0.5f);
+    auto net2 = createNetworkWithMean(0.7f);
+    auto net3 = createNetworkWithMean(0.5f);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}, true),
+              NetworkCompilationContext::computeHash(net2, {}, true));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}, true),
+              NetworkCompilationContext::computeHash(net3, {}, true));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
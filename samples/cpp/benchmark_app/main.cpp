@@ -72,6 +72,11 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         throw std::logic_error(err);
     }
 
+    if (FLAGS_pc_hw) {
+        // hardware counters are reported along with the regular ones
+        FLAGS_pc = true;
+    }
+
     if ((FLAGS_report_type == averageCntReport) && ((FLAGS_d.find("MULTI") != std::string::npos))) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
@@ -309,6 +314,9 @@ int main(int argc, char* argv[]) {
                 if (isFlagSetInCommandLine("nthreads"))
                     device_config[CONFIG_KEY(CPU_THREADS_NUM)] = std::to_string(FLAGS_nthreads);
 
+                if (FLAGS_pc_hw)
+                    device_config["CPU_HW_PERF_COUNTERS"] = CONFIG_VALUE(YES);
+
                 if (isFlagSetInCommandLine("enforcebf16"))
                     device_config[CONFIG_KEY(ENFORCE_BF16)] = FLAGS_enforcebf16 ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO);
 
@@ -792,6 +800,9 @@ int main(int argc, char* argv[]) {
                 }
                 perfCounts.push_back(reqPerfCounts);
             }
+            if (FLAGS_pc_hw) {
+                printHwPerformanceCounters(exeNetwork.GetExecGraphInfo(), std::cout);
+            }
             if (statistics) {
                 statistics->dumpPerformanceCounters(perfCounts);
             }
@@ -4,10 +4,13 @@
 
 // clang-format off
 #include <algorithm>
+#include <iomanip>
 #include <map>
+#include <ngraph/variant.hpp>
 #include <regex>
 #include <samples/common.hpp>
 #include <samples/slog.hpp>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -217,6 +220,58 @@ std::map<std::string, std::vector<float>> parseScaleOrMean(const std::string& sc
     return return_value;
 }
 
+void printHwPerformanceCounters(const InferenceEngine::CNNNetwork& execGraph, std::ostream& stream) {
+    const auto function = execGraph.getFunction();
+    if (!function)
+        return;
+
+    auto getRuntimeInfo = [](const std::shared_ptr<ngraph::Node>& node, const std::string& key) -> std::string {
+        const auto& rtInfo = node->get_rt_info();
+        const auto it = rtInfo.find(key);
+        if (it == rtInfo.end())
+            return {};
+        const auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+        return value ? value->get() : std::string{};
+    };
+
+    std::ios::fmtflags fmt(stream.flags());
+    bool hasCounters = false;
+    for (const auto& node : function->get_ordered_ops()) {
+        const auto cycles = getRuntimeInfo(node, "hwCycles");
+        if (cycles.empty())
+            continue;
+        if (!hasCounters) {
+            stream << std::endl << "hardware performance counts (average per inference):" << std::endl << std::endl;
+            hasCounters = true;
+        }
+        const auto instructions = getRuntimeInfo(node, "hwInstructions");
+        const auto bandwidth = getRuntimeInfo(node, "hwMemBandwidthMBps");
+
+        std::string name = node->get_friendly_name();
+        const size_t maxLayerName = 30;
+        if (name.length() >= maxLayerName) {
+            name = name.substr(0, maxLayerName - 4) + "...";
+        }
+        // low IPC along with high memory bandwidth means the layer is memory-bound
+        const double ipc = std::stod(instructions) / std::max(std::stod(cycles), 1.0);
+        std::ostringstream ipcStr;
+        ipcStr << std::fixed << std::setprecision(2) << ipc;
+
+        stream << std::setw(maxLayerName) << std::left << name;
+        stream << std::setw(25) << std::left << "cycles: " + cycles;
+        stream << std::setw(30) << std::left << "instructions: " + instructions;
+        stream << std::setw(12) << std::left << "IPC: " + ipcStr.str();
+        stream << std::setw(25) << std::left << "LLC misses: " + getRuntimeInfo(node, "hwLlcMisses");
+        stream << "memory bandwidth: " << (bandwidth.empty() ? "n/a" : bandwidth + " MB/s") << std::endl;
+    }
+    if (!hasCounters) {
+        slog::warn << "Hardware performance counters are not available: they are collected by CPU device on Linux "
+                      "only, check that perf_event_paranoid allows to use them"
+                   << slog::endl;
+    }
+    stream.flags(fmt);
+}
+
 #ifdef USE_OPENCV
 void dump_config(const std::string& filename, const std::map<std::string, std::map<std::string, std::string>>& config) {
     auto plugin_to_opencv_format = [](const std::string& str) -> std::string {
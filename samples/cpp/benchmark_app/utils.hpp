@@ -157,6 +157,11 @@ benchmark_app::InputsInfo getInputsInfo(const std::string& shape_string,
                             reshape_required);
 }
 
+/**
+ * @brief Prints the hardware performance counters which are stored by the CPU plugin to the execution graph
+ */
+void printHwPerformanceCounters(const InferenceEngine::CNNNetwork& execGraph, std::ostream& stream);
+
 #ifdef USE_OPENCV
 void dump_config(const std::string& filename, const std::map<std::string, std::map<std::string, std::string>>& config);
 void load_config(const std::string& filename, std::map<std::string, std::map<std::string, std::string>>& config);
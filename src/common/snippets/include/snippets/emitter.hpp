@@ -31,6 +31,8 @@ public:
     Emitter(std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>>& region) {
     }
 
+    virtual ~Emitter() = default;
+
     /**
      * @brief called by generator to generate code to produce target code for a specific operation
      * @param in vector of vector argument registers
@@ -24,6 +24,8 @@ TRANSFORMATIONS_API auto getRegisters(std::shared_ptr<ngraph::Node>& n) -> ngrap
  */
 class TRANSFORMATIONS_API TargetMachine {
 public:
+    virtual ~TargetMachine() = default;
+
     /**
      * @brief checks if target is natively supported
      * @return true, if supported
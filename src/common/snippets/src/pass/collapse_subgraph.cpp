@@ -236,11 +236,12 @@ ngraph::snippets::pass::StartSubgraph::StartSubgraph(bool tokenize_by_node) : Ma
 
     register_matcher(std::make_shared<pattern::Matcher>(
         std::make_shared<pattern::op::Label>(pattern::any_input(),
-        [tokenize_by_node, has_multiple_output_edges](std::shared_ptr<Node> n) {
+        [this, tokenize_by_node, has_multiple_output_edges](std::shared_ptr<Node> n) {
             return is_lo(n) &&
                    has_supported_in_out(n) &&
                    (tokenize_by_node || !has_subgraph_as_input(n)) &&
-                   has_multiple_output_edges(n);
+                   has_multiple_output_edges(n) &&
+                   !transformation_callback(n);
         })),
         [](ngraph::pattern::Matcher &m) -> bool {
         auto node = m.get_match_root();
@@ -523,8 +524,8 @@ ngraph::snippets::pass::AttachToSubgraph::AttachToSubgraph(bool tokenize_by_node
 
     register_matcher(std::make_shared<pattern::Matcher>(
         std::make_shared<pattern::op::Label>(pattern::any_input(),
-        [](std::shared_ptr<Node> n) {
-            return is_lo(n) && has_supported_in_out(n) && has_subgraph_as_input(n);
+        [this](std::shared_ptr<Node> n) {
+            return is_lo(n) && has_supported_in_out(n) && has_subgraph_as_input(n) && !transformation_callback(n);
         })),
         continuation_callback);
 }
@@ -21,6 +21,7 @@ class TRANSFORMATIONS_API TransposeConvert;
 class TRANSFORMATIONS_API TransposeReduction;
 class TRANSFORMATIONS_API TransposeFQReduction;
 class TRANSFORMATIONS_API TransposeFuse;
+class TRANSFORMATIONS_API TransposeEltwise;
 
 }  // namespace pass
 }  // namespace ngraph
@@ -66,6 +67,18 @@ public:
     TransposeFuse();
 };
 
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief TransposeEltwise transformation sinks Transpose through Add, Subtract, Multiply and Divide with a Constant
+ * second input, the Constant is transposed accordingly. It allows to eliminate the layout conversions around
+ * the per-channel operations (e.g. the mean and scale values of preprocessing) by the following TransposeFuse.
+ */
+class ngraph::pass::TransposeEltwise : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeEltwise();
+};
+
 /**
  * @ingroup ie_transformation_common_api
  * @brief TransposeSinking transformation sinks Transposes through known operations
@@ -27,11 +27,21 @@ public:
      *
      * @param output_hash_value Reference to output value. By applying hash pass on function, resulting hash value
      * will be set to this variable
+     * @param hash_constants If false, the data of constants marked with weights_file_key runtime info is not hashed,
+     * only their types and shapes are. It's up to the caller to take the values of such constants into account in some
+     * other way (e.g. by info of the weights file). The data of other constants (e.g. added by preprocessing after the
+     * model is read) is always hashed
      */
-    Hash(uint64_t& output_hash_value);
+    Hash(uint64_t& output_hash_value, bool hash_constants = true);
+
+    /**
+     * @brief Runtime info key of the constants which data is read from the weights file
+     */
+    static constexpr const char* weights_file_key = "weights_file";
 
 private:
     uint64_t& m_hash;
+    bool m_hash_constants;
 };
 
 
@@ -20,6 +20,7 @@ NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeConvert, "TransposeConvert", 0);
 NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeReduction, "TransposeReduction", 0);
 NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeFQReduction, "TransposeFQReduction", 0);
 NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeFuse, "TransposeFuse", 0);
+NGRAPH_RTTI_DEFINITION(ngraph::pass::TransposeEltwise, "TransposeEltwise", 0);
 
 using namespace ngraph;
 
@@ -255,3 +256,56 @@ ngraph::pass::TransposeFuse::TransposeFuse() {
     auto m = std::make_shared<ngraph::pattern::Matcher>(transpose_2, matcher_name);
     register_matcher(m, matcher_pass_callback);
 }
+
+ngraph::pass::TransposeEltwise::TransposeEltwise() {
+    MATCHER_SCOPE(TransposeEltwise);
+
+    auto transpose_label = pattern::wrap_type<opset6::Transpose>({pattern::any_input(),
+                                                                  pattern::wrap_type<opset6::Constant>()},
+                                                                  pattern::consumers_count(1));
+    auto constant_label = pattern::wrap_type<opset6::Constant>();
+    auto eltwise_label = pattern::wrap_type<opset6::Add, opset6::Subtract, opset6::Multiply, opset6::Divide>({transpose_label, constant_label});
+
+    matcher_pass_callback matcher_pass_callback = [=](ngraph::pattern::Matcher &m) {
+        const auto &pattern_to_output = m.get_pattern_value_map();
+        auto transpose = pattern_to_output.at(transpose_label).get_node_shared_ptr();
+        auto constant = pattern_to_output.at(constant_label).get_node_shared_ptr();
+        auto eltwise = pattern_to_output.at(eltwise_label).get_node_shared_ptr();
+        auto order = std::dynamic_pointer_cast<opset6::Constant>(transpose->get_input_node_shared_ptr(1));
+        if (!order || eltwise->get_autob().m_type != ngraph::op::AutoBroadcastType::NUMPY)
+            return false;
+
+        // the Constant must not broadcast the data, otherwise the Transpose would be applied to the other shape
+        const auto &output_shape = eltwise->get_output_partial_shape(0);
+        if (output_shape.rank().is_dynamic() || output_shape != transpose->get_output_partial_shape(0))
+            return false;
+
+        const auto rank = static_cast<size_t>(output_shape.rank().get_length());
+        auto constant_shape = constant->get_output_shape(0);
+        if (constant_shape.size() > rank)
+            return false;
+
+        // the rank of the Constant is aligned with the data according to the numpy broadcasting before the Transpose
+        Output<Node> new_constant = constant;
+        if (constant_shape.size() < rank) {
+            constant_shape.insert(constant_shape.begin(), rank - constant_shape.size(), 1);
+            auto target_shape = opset6::Constant::create(element::i64, {rank}, constant_shape);
+            new_constant = op::util::make_try_fold<opset6::Reshape>(new_constant, target_shape, false);
+        }
+        new_constant = op::util::make_try_fold<opset6::Transpose>(new_constant, get_reversed_order_constant(order));
+
+        const bool transpose_is_first = eltwise->get_input_node_shared_ptr(0) == transpose;
+        auto new_eltwise = transpose_is_first ? eltwise->clone_with_new_inputs({transpose->input_value(0), new_constant})
+                                              : eltwise->clone_with_new_inputs({new_constant, transpose->input_value(0)});
+        auto new_transpose = transpose->clone_with_new_inputs({new_eltwise, transpose->input_value(1)});
+        register_new_node(new_transpose);
+
+        new_transpose->set_friendly_name(eltwise->get_friendly_name());
+        copy_runtime_info({transpose, eltwise}, {new_eltwise, new_transpose});
+        replace_node(eltwise, new_transpose);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(eltwise_label, matcher_name);
+    register_matcher(m, matcher_pass_callback);
+}
@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the fast non-cryptographic hash of binary data
+ * @file xxhash.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Streaming implementation of the 64-bit xxHash algorithm.
+ * The data is processed in four independent lanes of 64-bit words, so the compiler keeps all of them in registers
+ * and the hashing speed is close to the memory bandwidth. The result does not depend on how the data is split
+ * between the update() calls.
+ */
+class XXHash64 {
+public:
+    explicit XXHash64(uint64_t seed = 0);
+
+    /**
+     * @brief Appends the data to the hashed sequence
+     */
+    void update(const void* data, size_t size);
+
+    /**
+     * @brief Returns the hash of the data appended so far. The object can still be updated afterwards.
+     */
+    uint64_t digest() const;
+
+private:
+    static constexpr size_t stripe_size = 32;
+
+    uint64_t m_lanes[4];
+    uint64_t m_seed;
+    uint64_t m_total_size = 0;
+    unsigned char m_tail[stripe_size];
+    size_t m_tail_size = 0;
+};
+
+/**
+ * @brief Computes 64-bit xxHash of the data
+ */
+uint64_t xxhash64(const void* data, size_t size, uint64_t seed = 0);
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace ov {
+namespace util {
+namespace {
+
+class HandleHolder {
+public:
+    explicit HandleHolder(int fd) : m_fd(fd) {}
+    HandleHolder(const HandleHolder&) = delete;
+    HandleHolder& operator=(const HandleHolder&) = delete;
+    ~HandleHolder() {
+        if (m_fd != -1) {
+            ::close(m_fd);
+        }
+    }
+    int get() const noexcept {
+        return m_fd;
+    }
+
+private:
+    int m_fd = -1;
+};
+
+class MapHolder : public MappedMemory {
+public:
+    explicit MapHolder(const std::string& path) {
+        // the mapping keeps the file referenced, so the descriptor is closed right after mmap
+        HandleHolder fd(::open(path.c_str(), O_RDONLY));
+        if (fd.get() == -1) {
+            throw_error("Cannot open file", path);
+        }
+
+        struct stat sb = {};
+        if (::fstat(fd.get(), &sb) == -1) {
+            throw_error("Cannot get size of file", path);
+        }
+        m_size = static_cast<size_t>(sb.st_size);
+        // an empty file can not be mapped, data() points to a valid empty buffer instead
+        if (m_size == 0) {
+            return;
+        }
+
+        m_data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd.get(), 0);
+        if (m_data == MAP_FAILED) {
+            m_data = nullptr;
+            throw_error("Cannot map file", path);
+        }
+    }
+
+    ~MapHolder() override {
+        if (m_data != nullptr) {
+            ::munmap(m_data, m_size);
+        }
+    }
+
+    char* data() noexcept override {
+        static char empty[1] = {};
+        return m_data != nullptr ? static_cast<char*>(m_data) : empty;
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    static void throw_error(const char* message, const std::string& path) {
+        std::stringstream ss;
+        ss << message << " '" << path << "': " << std::strerror(errno);
+        throw std::runtime_error(ss.str());
+    }
+
+    void* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+}  // namespace
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    return std::make_shared<MapHolder>(path);
+}
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    return load_mmap_object(ov::util::wstring_to_string(path));
+}
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
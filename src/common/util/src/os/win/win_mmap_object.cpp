@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+#include <stdexcept>
+
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+#ifndef NOMINMAX
+#    define NOMINMAX
+#endif
+
+#include <windows.h>
+
+namespace ov {
+namespace util {
+namespace {
+
+class HandleHolder {
+public:
+    explicit HandleHolder(HANDLE handle = INVALID_HANDLE_VALUE) : m_handle(handle) {}
+    HandleHolder(const HandleHolder&) = delete;
+    HandleHolder& operator=(const HandleHolder&) = delete;
+    ~HandleHolder() {
+        reset(INVALID_HANDLE_VALUE);
+    }
+    void reset(HANDLE handle) {
+        if (m_handle != 0 && m_handle != INVALID_HANDLE_VALUE) {
+            ::CloseHandle(m_handle);
+        }
+        m_handle = handle;
+    }
+    HANDLE get() const noexcept {
+        return m_handle;
+    }
+
+private:
+    HANDLE m_handle = INVALID_HANDLE_VALUE;
+};
+
+class MapHolder : public MappedMemory {
+public:
+    explicit MapHolder(HANDLE file, const std::string& path) {
+        m_file.reset(file);
+        if (m_file.get() == INVALID_HANDLE_VALUE) {
+            throw_error("Cannot open file", path);
+        }
+
+        LARGE_INTEGER file_size;
+        if (!::GetFileSizeEx(m_file.get(), &file_size)) {
+            throw_error("Cannot get size of file", path);
+        }
+        m_size = static_cast<size_t>(file_size.QuadPart);
+        // an empty file can not be mapped, data() points to a valid empty buffer instead
+        if (m_size == 0) {
+            return;
+        }
+
+        m_mapping.reset(::CreateFileMapping(m_file.get(), nullptr, PAGE_READONLY, 0, 0, nullptr));
+        if (m_mapping.get() == 0) {
+            throw_error("Cannot create mapping of file", path);
+        }
+
+        m_data = ::MapViewOfFile(m_mapping.get(), FILE_MAP_READ, 0, 0, 0);
+        if (m_data == nullptr) {
+            throw_error("Cannot map file", path);
+        }
+    }
+
+    ~MapHolder() override {
+        if (m_data != nullptr) {
+            ::UnmapViewOfFile(m_data);
+        }
+    }
+
+    char* data() noexcept override {
+        static char empty[1] = {};
+        return m_data != nullptr ? static_cast<char*>(m_data) : empty;
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    static void throw_error(const char* message, const std::string& path) {
+        std::stringstream ss;
+        ss << message << " '" << path << "': " << ::GetLastError();
+        throw std::runtime_error(ss.str());
+    }
+
+    void* m_data = nullptr;
+    size_t m_size = 0;
+    HandleHolder m_file;
+    HandleHolder m_mapping;
+};
+
+}  // namespace
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    HANDLE file =
+        ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    return std::make_shared<MapHolder>(file, path);
+}
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    HANDLE file =
+        ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    return std::make_shared<MapHolder>(file, ov::util::wstring_to_string(path));
+}
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
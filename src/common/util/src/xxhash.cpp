@@ -0,0 +1,132 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/xxhash.hpp"
+
+#include <cstring>
+
+namespace {
+
+constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t prime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t round(uint64_t acc, uint64_t input) {
+    acc += input * prime2;
+    acc = rotl(acc, 31);
+    return acc * prime1;
+}
+
+inline uint64_t merge_round(uint64_t acc, uint64_t lane) {
+    return (acc ^ round(0, lane)) * prime1 + prime4;
+}
+
+inline uint64_t read64(const unsigned char* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read32(const unsigned char* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+// processes the whole stripes and returns the pointer to the first unprocessed byte
+inline const unsigned char* consume_stripes(uint64_t* lanes, const unsigned char* p, const unsigned char* end) {
+    uint64_t v0 = lanes[0], v1 = lanes[1], v2 = lanes[2], v3 = lanes[3];
+    while (end - p >= 32) {
+        v0 = round(v0, read64(p));
+        v1 = round(v1, read64(p + 8));
+        v2 = round(v2, read64(p + 16));
+        v3 = round(v3, read64(p + 24));
+        p += 32;
+    }
+    lanes[0] = v0;
+    lanes[1] = v1;
+    lanes[2] = v2;
+    lanes[3] = v3;
+    return p;
+}
+
+}  // namespace
+
+namespace ov {
+namespace util {
+
+XXHash64::XXHash64(uint64_t seed)
+    : m_lanes{seed + prime1 + prime2, seed + prime2, seed, seed - prime1},
+      m_seed(seed) {}
+
+void XXHash64::update(const void* data, size_t size) {
+    auto p = static_cast<const unsigned char*>(data);
+    const auto end = p + size;
+    m_total_size += size;
+
+    if (m_tail_size + size < stripe_size) {
+        std::memcpy(m_tail + m_tail_size, p, size);
+        m_tail_size += size;
+        return;
+    }
+
+    if (m_tail_size > 0) {
+        const size_t fill = stripe_size - m_tail_size;
+        std::memcpy(m_tail + m_tail_size, p, fill);
+        consume_stripes(m_lanes, m_tail, m_tail + stripe_size);
+        p += fill;
+        m_tail_size = 0;
+    }
+
+    p = consume_stripes(m_lanes, p, end);
+
+    m_tail_size = static_cast<size_t>(end - p);
+    std::memcpy(m_tail, p, m_tail_size);
+}
+
+uint64_t XXHash64::digest() const {
+    uint64_t h;
+    if (m_total_size >= stripe_size) {
+        h = rotl(m_lanes[0], 1) + rotl(m_lanes[1], 7) + rotl(m_lanes[2], 12) + rotl(m_lanes[3], 18);
+        for (auto lane : m_lanes)
+            h = merge_round(h, lane);
+    } else {
+        h = m_seed + prime5;
+    }
+
+    h += m_total_size;
+
+    const unsigned char* p = m_tail;
+    const unsigned char* const end = m_tail + m_tail_size;
+    for (; p + 8 <= end; p += 8)
+        h = rotl(h ^ round(0, read64(p)), 27) * prime1 + prime4;
+    if (p + 4 <= end) {
+        h = rotl(h ^ (static_cast<uint64_t>(read32(p)) * prime1), 23) * prime2 + prime3;
+        p += 4;
+    }
+    for (; p < end; p++)
+        h = rotl(h ^ (*p * prime5), 11) * prime1;
+
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+uint64_t xxhash64(const void* data, size_t size, uint64_t seed) {
+    XXHash64 hasher(seed);
+    hasher.update(data, size);
+    return hasher.digest();
+}
+
+}  // namespace util
+}  // namespace ov
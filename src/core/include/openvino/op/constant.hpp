@@ -162,6 +162,7 @@ public:
         : m_element_type(type),
           m_shape(shape) {
         m_data = data;
+        m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
         constructor_validate_and_infer_types();
     }
 
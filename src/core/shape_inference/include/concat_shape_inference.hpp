@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <openvino/op/concat.hpp>
+#include "utils.hpp"
+
+template <class T>
+void shape_infer(const ov::op::v0::Concat* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    using DimType = typename std::iterator_traits<typename T::iterator>::value_type;
+    NODE_VALIDATION_CHECK(op, !input_shapes.empty() && output_shapes.size() == 1);
+
+    const auto& first_shape = input_shapes[0];
+    NODE_VALIDATION_CHECK(op, first_shape.rank().is_static(), "Concat shape inference requires inputs of static rank");
+    const int64_t rank = static_cast<int64_t>(first_shape.size());
+    int64_t axis = op->get_axis();
+    NODE_VALIDATION_CHECK(op, -rank <= axis && axis < rank,
+                          "Concatenation axis (", axis, ") is out of bounds [", -rank, ", ", rank - 1, "]");
+    if (axis < 0)
+        axis += rank;
+
+    auto& output_shape = output_shapes[0];
+    output_shape = first_shape;
+    for (size_t i = 1; i < input_shapes.size(); i++) {
+        const auto& input_shape = input_shapes[i];
+        NODE_VALIDATION_CHECK(op, input_shape.rank().is_static() && static_cast<int64_t>(input_shape.size()) == rank,
+                              "Argument shapes are inconsistent; they must have the same rank, and must have ",
+                              "equal dimension everywhere except on the concatenation axis (axis ", axis, ").");
+        for (int64_t j = 0; j < rank; j++) {
+            if (j == axis) {
+                output_shape[j] = output_shape[j] + input_shape[j];
+            } else {
+                NODE_VALIDATION_CHECK(op, DimType::merge(output_shape[j], output_shape[j], input_shape[j]),
+                                      "Argument shapes are inconsistent; they must have the same rank, and must have ",
+                                      "equal dimension everywhere except on the concatenation axis (axis ", axis, ").");
+            }
+        }
+    }
+}
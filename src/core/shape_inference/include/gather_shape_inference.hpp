@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <openvino/op/gather.hpp>
+#include "utils.hpp"
+
+template <class T>
+void gather_shape_infer(const ov::op::util::GatherBase* op, int64_t batch_dims,
+                        const std::vector<T>& input_shapes, std::vector<T>& output_shapes,
+                        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 3 && output_shapes.size() == 1);
+    std::vector<int64_t> axes;
+    bool axis_is_constant = get_data_as_int64<T>(2, op, axes, constant_data);
+    NODE_VALIDATION_CHECK(op, axis_is_constant && axes.size() == 1, "Shape inference lacks input data");
+
+    const auto& data_shape = input_shapes[0];
+    const auto& indices_shape = input_shapes[1];
+    NODE_VALIDATION_CHECK(op, data_shape.rank().is_static() && indices_shape.rank().is_static(),
+                          "Gather shape inference requires inputs of static rank");
+    const int64_t data_rank = static_cast<int64_t>(data_shape.size());
+    const int64_t indices_rank = static_cast<int64_t>(indices_shape.size());
+
+    int64_t axis = axes[0];
+    NODE_VALIDATION_CHECK(op, -data_rank <= axis && axis < data_rank,
+                          "The axis must be >= 0 and < data_rank. But instead got axis = ", axis, " data_rank = ", data_rank);
+    if (axis < 0)
+        axis += data_rank;
+
+    if (batch_dims < 0)
+        batch_dims += indices_rank;
+    NODE_VALIDATION_CHECK(op, batch_dims >= 0 && batch_dims <= axis && batch_dims <= indices_rank,
+                          "The batch_dims must be >= 0 and <= axis and <= indices_rank. But instead got: batch_dims = ",
+                          batch_dims, ", axis = ", axis, ", indices_rank = ", indices_rank);
+
+    // output shape is data[:axis] + indices[batch_dims:] + data[axis + 1:]
+    auto& output_shape = output_shapes[0];
+    output_shape.resize(data_rank - 1 + indices_rank - batch_dims);
+    size_t idx = 0;
+    for (int64_t i = 0; i < axis; i++)
+        output_shape[idx++] = data_shape[i];
+    for (int64_t i = batch_dims; i < indices_rank; i++)
+        output_shape[idx++] = indices_shape[i];
+    for (int64_t i = axis + 1; i < data_rank; i++)
+        output_shape[idx++] = data_shape[i];
+}
+
+template <class T>
+void shape_infer(const ov::op::v1::Gather* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes,
+                 const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data = {}) {
+    gather_shape_infer(op, 0, input_shapes, output_shapes, constant_data);
+}
+
+template <class T>
+void shape_infer(const ov::op::v7::Gather* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes,
+                 const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data = {}) {
+    gather_shape_infer(op, op->get_batch_dims(), input_shapes, output_shapes, constant_data);
+}
+
+template <class T>
+void shape_infer(const ov::op::v8::Gather* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes,
+                 const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data = {}) {
+    gather_shape_infer(op, op->get_batch_dims(), input_shapes, output_shapes, constant_data);
+}
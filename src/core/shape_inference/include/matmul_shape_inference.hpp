@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <openvino/op/matmul.hpp>
+#include "utils.hpp"
+
+template <class T>
+void shape_infer(const ov::op::v0::MatMul* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    using DimType = typename std::iterator_traits<typename T::iterator>::value_type;
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 2 && output_shapes.size() == 1);
+
+    const auto& arg0_shape = input_shapes[0];
+    const auto& arg1_shape = input_shapes[1];
+    NODE_VALIDATION_CHECK(op, arg0_shape.rank().is_static() && arg1_shape.rank().is_static(),
+                          "MatMul shape inference requires inputs of static rank");
+    const size_t arg0_rank = arg0_shape.size();
+    const size_t arg1_rank = arg1_shape.size();
+    NODE_VALIDATION_CHECK(op, arg0_rank != 0 && arg1_rank != 0, "Scalars are not supported as MatMul inputs.");
+
+    // Transpose attributes are ignored for 1D tensors, the first one is treated as a row vector
+    // and the second one as a column vector. Their unit dimensions are not present in the output.
+    const bool transpose_a = op->get_transpose_a() && arg0_rank > 1;
+    const bool transpose_b = op->get_transpose_b() && arg1_rank > 1;
+    const DimType arg0_rows = arg0_rank == 1 ? DimType(1) : arg0_shape[arg0_rank - (transpose_a ? 1 : 2)];
+    const DimType arg0_cols = arg0_shape[arg0_rank - (transpose_a ? 2 : 1)];
+    const DimType arg1_rows = arg1_shape[arg1_rank - (transpose_b || arg1_rank == 1 ? 1 : 2)];
+    const DimType arg1_cols = arg1_rank == 1 ? DimType(1) : arg1_shape[arg1_rank - (transpose_b ? 2 : 1)];
+
+    NODE_VALIDATION_CHECK(op, arg0_cols.compatible(arg1_rows),
+                          "Incompatible MatMul matrix dimension. First input dimension=", arg0_cols,
+                          " doesn't match the second input dimension=", arg1_rows);
+
+    // Batch dimensions are broadcasted according to the numpy rules
+    const size_t arg0_batch_rank = arg0_rank > 2 ? arg0_rank - 2 : 0;
+    const size_t arg1_batch_rank = arg1_rank > 2 ? arg1_rank - 2 : 0;
+    const size_t batch_rank = std::max(arg0_batch_rank, arg1_batch_rank);
+
+    auto& output_shape = output_shapes[0];
+    output_shape.resize(batch_rank + (arg0_rank > 1 ? 1 : 0) + (arg1_rank > 1 ? 1 : 0));
+    for (size_t i = 0; i < batch_rank; i++) {
+        const DimType arg0_dim = i < batch_rank - arg0_batch_rank ? DimType(1) : arg0_shape[i - (batch_rank - arg0_batch_rank)];
+        const DimType arg1_dim = i < batch_rank - arg1_batch_rank ? DimType(1) : arg1_shape[i - (batch_rank - arg1_batch_rank)];
+        NODE_VALIDATION_CHECK(op, DimType::broadcast_merge(output_shape[i], arg0_dim, arg1_dim),
+                              "Incompatible MatMul batch dimension. Can't merge first input dimension=", arg0_dim,
+                              " with second input dimension=", arg1_dim, " at index=", i);
+    }
+
+    size_t idx = batch_rank;
+    if (arg0_rank > 1)
+        output_shape[idx++] = arg0_rows;
+    if (arg1_rank > 1)
+        output_shape[idx] = arg1_cols;
+}
@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <openvino/core/axis_vector.hpp>
+#include <openvino/op/transpose.hpp>
+#include "utils.hpp"
+
+template <class T>
+void shape_infer(const ov::op::v1::Transpose* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes,
+                 const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data = {}) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 2 && output_shapes.size() == 1);
+    std::vector<int64_t> order;
+    bool order_is_constant = get_data_as_int64<T>(1, op, order, constant_data);
+    NODE_VALIDATION_CHECK(op, order_is_constant, "Shape inference lacks input data");
+
+    const auto& input_shape = input_shapes[0];
+    NODE_VALIDATION_CHECK(op, input_shape.rank().is_static(), "Transpose shape inference requires input of static rank");
+    const size_t rank = input_shape.size();
+    auto& output_shape = output_shapes[0];
+
+    // empty order means the reversed order of dimensions
+    if (order.empty()) {
+        output_shape.resize(rank);
+        for (size_t i = 0; i < rank; i++)
+            output_shape[i] = input_shape[rank - 1 - i];
+        return;
+    }
+
+    NODE_VALIDATION_CHECK(op, order.size() == rank,
+                          "Permutation ", ov::AxisVector(order.begin(), order.end()),
+                          " is not valid for input shape ", input_shape);
+    output_shape.resize(rank);
+    for (size_t i = 0; i < rank; i++) {
+        NODE_VALIDATION_CHECK(op, order[i] >= 0 && static_cast<size_t>(order[i]) < rank,
+                              "Permutation ", ov::AxisVector(order.begin(), order.end()),
+                              " is not valid for input shape ", input_shape);
+        output_shape[i] = input_shape[order[i]];
+    }
+}
@@ -33,3 +33,35 @@ inline bool get_data_as_int64<ov::PartialShape>(
     }
     return true;
 }
+
+template <class OpType, class ShapeType>
+void copy_shape_infer(const OpType* op, const std::vector<ShapeType>& input_shapes, std::vector<ShapeType>& output_shapes) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 1 && output_shapes.size() == 1,
+                          "Incorrect number of input/output shapes");
+    output_shapes[0] = input_shapes[0];
+}
+
+template <class OpType, class ShapeType>
+void first_input_passthrough_infer(const OpType* op, const std::vector<ShapeType>& input_shapes, std::vector<ShapeType>& output_shapes) {
+    NODE_VALIDATION_CHECK(op, output_shapes.size() == 1 && input_shapes.size() >= 1,
+                          "Incorrect number of input and output shapes");
+    output_shapes[0] = input_shapes[0];
+}
+
+template <class OpType, class ShapeType>
+void eltwise_shape_infer(const OpType* op, const std::vector<ShapeType>& input_shapes, std::vector<ShapeType>& output_shapes) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 2 && output_shapes.size() == 1,
+                          "Incorrect number of input/output shapes");
+    auto& output_shape = output_shapes[0];
+    output_shape = input_shapes[0];
+    const auto& autob = op->get_autob();
+    if (autob.m_type == ov::op::AutoBroadcastType::NONE) {
+        NODE_VALIDATION_CHECK(op, ShapeType::merge_into(output_shape, input_shapes[1]),
+                              "Argument shapes are inconsistent.");
+    } else if (autob.m_type == ov::op::AutoBroadcastType::NUMPY || autob.m_type == ov::op::AutoBroadcastType::PDPD) {
+        NODE_VALIDATION_CHECK(op, ShapeType::broadcast_merge_into(output_shape, input_shapes[1], autob),
+                              "Argument shapes are inconsistent.");
+    } else {
+        NODE_VALIDATION_CHECK(op, false, "Unsupported auto broadcast specification");
+    }
+}
@@ -4,11 +4,13 @@
 
 #include "openvino/pass/serialize.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
 #include <fstream>
 #include <ngraph/variant.hpp>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -18,6 +20,7 @@
 #include "ngraph/opsets/opset1.hpp"
 #include "openvino/op/util/framework_node.hpp"
 #include "openvino/pass/constant_folding.hpp"
+#include "openvino/util/xxhash.hpp"
 #include "pugixml.hpp"
 #include "transformations/hash.hpp"
 
@@ -1042,7 +1045,8 @@ void serializeFunc(std::ostream& xml_file,
                    std::shared_ptr<ov::Function> f,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                   bool deterministic = false) {
+                   bool deterministic = false,
+                   bool deduplicate_constants = true) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = f->get_rt_info();
@@ -1064,7 +1068,7 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
+    ConstantWriter constant_write_handler(bin_file, deduplicate_constants);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
 
@@ -1230,50 +1234,142 @@ static uint64_t hash_combine(uint64_t seed, const T& a) {
     return seed ^ (std::hash<T>()(a) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
 }
 
+// Hashes the stream data as a sequence of fixed size blocks. The blocks of large writes (i.e. the constants data)
+// are hashed by several threads, then the block hashes are combined in order, so the result is deterministic and
+// does not depend on how the data is split between the writes.
 class OstreamHashWrapper final : public std::streambuf {
-    uint64_t m_res = 0;
+    static constexpr size_t block_size = 1 << 20;
+    static constexpr size_t min_blocks_per_thread = 4;
+
+    bool m_hash_data;
+    ov::util::XXHash64 m_blocks_hash;
+    ov::util::XXHash64 m_block_hash;
+    size_t m_block_filled = 0;
+    uint64_t m_total_size = 0;
+
+    void append_block_hash(uint64_t block_hash) {
+        m_blocks_hash.update(&block_hash, sizeof(block_hash));
+    }
+
+    void hash_whole_blocks(const char* s, size_t blocks_count) {
+        const size_t threads_count =
+            std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), blocks_count / min_blocks_per_thread);
+        if (threads_count <= 1) {
+            for (size_t b = 0; b < blocks_count; b++)
+                append_block_hash(ov::util::xxhash64(s + b * block_size, block_size));
+            return;
+        }
+
+        std::vector<uint64_t> block_hashes(blocks_count);
+        auto hash_range = [&](size_t thread_id) {
+            for (size_t b = thread_id; b < blocks_count; b += threads_count)
+                block_hashes[b] = ov::util::xxhash64(s + b * block_size, block_size);
+        };
+        std::vector<std::thread> threads;
+        threads.reserve(threads_count - 1);
+        for (size_t t = 1; t < threads_count; t++)
+            threads.emplace_back(hash_range, t);
+        hash_range(0);
+        for (auto& thread : threads)
+            thread.join();
+
+        for (auto block_hash : block_hashes)
+            append_block_hash(block_hash);
+    }
 
 public:
+    explicit OstreamHashWrapper(bool hash_data = true) : m_hash_data(hash_data) {}
+
     uint64_t getResult() const {
-        return m_res;
+        auto result = m_blocks_hash;
+        if (m_block_filled > 0) {
+            const auto last_block_hash = m_block_hash.digest();
+            result.update(&last_block_hash, sizeof(last_block_hash));
+        }
+        result.update(&m_total_size, sizeof(m_total_size));
+        return result.digest();
     }
 
     std::streamsize xsputn(const char* s, std::streamsize n) override {
-        auto* intS = (const std::streamsize*)s;
-        std::streamsize n64 = n / static_cast<std::streamsize>(sizeof(std::streamsize));
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
+        if (!m_hash_data || n <= 0)
+            return n;
+
+        auto size = static_cast<size_t>(n);
+        m_total_size += size;
+
+        if (m_block_filled > 0) {
+            const auto fill = std::min(size, block_size - m_block_filled);
+            m_block_hash.update(s, fill);
+            m_block_filled += fill;
+            s += fill;
+            size -= fill;
+            if (m_block_filled < block_size)
+                return n;
+            append_block_hash(m_block_hash.digest());
+            m_block_hash = ov::util::XXHash64();
+            m_block_filled = 0;
         }
 
-        std::streamsize rest = n % static_cast<std::streamsize>(sizeof(std::streamsize));
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
+        const size_t blocks_count = size / block_size;
+        hash_whole_blocks(s, blocks_count);
+        s += blocks_count * block_size;
+        size -= blocks_count * block_size;
+
+        if (size > 0) {
+            m_block_hash.update(s, size);
+            m_block_filled = size;
         }
         return n;
     }
 };
+
+// Hashes the data of the constants which are not read from the weights file, including the ones of the bodies
+void hash_not_file_constants(const ov::Function& f, ov::util::XXHash64& hash) {
+    for (const auto& node : f.get_ordered_ops()) {
+        if (const auto constant = ov::as_type<ov::op::v0::Constant>(node.get())) {
+            if (constant->get_rt_info().count(pass::Hash::weights_file_key) == 0) {
+                const uint64_t size = constant->get_byte_size();
+                hash.update(&size, sizeof(size));
+                hash.update(constant->get_data_ptr(), constant->get_byte_size());
+            }
+        } else if (const auto multi_subgraph = dynamic_cast<const ov::op::util::MultiSubGraphOp*>(node.get())) {
+            for (size_t i = 0; i < multi_subgraph->get_internal_subgraphs_size(); i++) {
+                hash_not_file_constants(*multi_subgraph->get_function(static_cast<int>(i)), hash);
+            }
+        }
+    }
+}
 }  // namespace
 
+constexpr const char* pass::Hash::weights_file_key;
+
 bool pass::Hash::run_on_function(std::shared_ptr<ov::Function> f) {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "pass::Hash");
     OstreamHashWrapper xmlHash;
-    OstreamHashWrapper binHash;
+    OstreamHashWrapper binHash(m_hash_constants);
     std::ostream xml(&xmlHash);
     std::ostream bin(&binHash);
 
-    // Determinism is important for hash calculation
-    serializeFunc(xml, bin, f, Serialize::Version::UNSPECIFIED, {}, true);
+    // Determinism is important for hash calculation. Constants are not deduplicated since the comparison of their
+    // data would cost as much as hashing it
+    serializeFunc(xml, bin, f, Serialize::Version::UNSPECIFIED, {}, true, false);
 
     uint64_t seed = 0;
     seed = hash_combine(seed, xmlHash.getResult());
     seed = hash_combine(seed, binHash.getResult());
+    if (!m_hash_constants) {
+        ov::util::XXHash64 constantsHash;
+        hash_not_file_constants(*f, constantsHash);
+        seed = hash_combine(seed, constantsHash.digest());
+    }
 
     m_hash = seed;
     // Return false because we didn't change nGraph Function
     return false;
 }
 
-pass::Hash::Hash(uint64_t& output_hash_value) : m_hash(output_hash_value) {}
+pass::Hash::Hash(uint64_t& output_hash_value, bool hash_constants)
+    : m_hash(output_hash_value),
+      m_hash_constants(hash_constants) {}
 
 }  // namespace ov
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/mmap_object.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "util/test_common.hpp"
+
+class MmapObjectTest : public ov::test::TestsCommon {
+protected:
+    const std::string m_file_path = GetTestName() + "_" + GetTimestamp() + ".bin";
+
+    void write_file(const std::string& content) {
+        std::ofstream file(m_file_path, std::ios::binary);
+        file.write(content.data(), content.size());
+    }
+
+    void TearDown() override {
+        std::remove(m_file_path.c_str());
+    }
+};
+
+TEST_F(MmapObjectTest, map_file) {
+    const std::string content = "mapped file content";
+    write_file(content);
+
+    const auto mapped = ov::util::load_mmap_object(m_file_path);
+    ASSERT_NE(mapped, nullptr);
+    ASSERT_EQ(mapped->size(), content.size());
+    ASSERT_NE(mapped->data(), nullptr);
+    EXPECT_EQ(std::string(mapped->data(), mapped->size()), content);
+}
+
+TEST_F(MmapObjectTest, map_empty_file) {
+    write_file("");
+
+    const auto mapped = ov::util::load_mmap_object(m_file_path);
+    ASSERT_NE(mapped, nullptr);
+    EXPECT_EQ(mapped->size(), 0);
+    // the callers offset into the data, so it must stay valid for an empty file
+    EXPECT_NE(mapped->data(), nullptr);
+}
+
+TEST_F(MmapObjectTest, map_missing_file) {
+    EXPECT_THROW(ov::util::load_mmap_object(m_file_path), std::runtime_error);
+}
@@ -1270,6 +1270,27 @@ NGRAPH_TEST(onnx_editor, values__modify_one_initializer) {
     test_case.run();
 }
 
+NGRAPH_TEST(onnx_editor, values__modify_initializer_shared_with_converted_function) {
+    onnx_editor::ONNXModelEditor editor{ngraph::file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc_initializers.onnx")};
+    // the Constant of the raw data initializer refers to the model data
+    const auto original_function = editor.get_function();
+
+    std::map<std::string, std::shared_ptr<ngraph::op::Constant>> in_vals;
+    in_vals.emplace("A", ngraph::op::Constant::create(element::f32, Shape{2, 2}, {5, 6, 7, 8}));
+    editor.set_input_values(in_vals);
+
+    const auto function = editor.get_function();
+    auto test_case = ngraph::test::TestCase<TestEngine>(function);
+    test_case.add_input<float>({1, 2, 3, 4});
+    test_case.add_expected_output<float>({7, 10, 13, 16});
+    test_case.run();
+
+    auto original_test_case = ngraph::test::TestCase<TestEngine>(original_function);
+    original_test_case.add_input<float>({1, 2, 3, 4});
+    original_test_case.add_expected_output<float>({3, 6, 9, 12});
+    original_test_case.run();
+}
+
 NGRAPH_TEST(onnx_editor, values__modify_two_initializers) {
     onnx_editor::ONNXModelEditor editor{
         ngraph::file_util::path_join(SERIALIZED_ZOO, "onnx/model_editor/add_1D_with_initializers.onnx")};
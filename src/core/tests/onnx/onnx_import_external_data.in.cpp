@@ -7,6 +7,7 @@
 #include "engines_util/test_engines.hpp"
 #include "gtest/gtest.h"
 #include "ngraph/file_util.hpp"
+#include "ngraph/op/constant.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_import/onnx.hpp"
 #include "util/test_control.hpp"
@@ -83,6 +84,68 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_constants_refer_to_mapped_file) {
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_two_tensors_data_in_the_same_file.onnx"));
+
+    std::map<std::string, std::shared_ptr<op::Constant>> constants;
+    for (const auto& node : function->get_ops()) {
+        if (const auto constant = std::dynamic_pointer_cast<op::Constant>(node)) {
+            constants[constant->get_friendly_name()] = constant;
+        }
+    }
+    ASSERT_EQ(constants.count("data_a"), 1);
+    ASSERT_EQ(constants.count("data_b"), 1);
+    // both tensors are stored in the same file, at the offsets 0 and 4096, which is mapped once
+    EXPECT_EQ(constants["data_b"]->get_data_ptr<char>() - constants["data_a"]->get_data_ptr<char>(), 4096);
+    EXPECT_EQ(constants["data_a"]->cast_vector<int32_t>(), (std::vector<int32_t>{3, 2, 1}));
+    EXPECT_EQ(constants["data_b"]->cast_vector<int32_t>(), (std::vector<int32_t>{1, 2, 3}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_without_length) {
+    // the data of the second tensor is read from the offset to the end of the file
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data_no_length.onnx"));
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    test_case.add_input<int32_t>({2, 3, 1});
+
+    test_case.add_expected_output<int32_t>({3, 3, 3});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_offset_out_of_range_exception) {
+    // the offset doesn't fit in 32 bits
+    try {
+        auto function = onnx_import::import_onnx_model(
+            file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data_offset_out_of_range.onnx"));
+        FAIL() << "Offset past the end of the external data file not detected";
+    } catch (const ngraph_error& error) {
+        EXPECT_PRED_FORMAT2(testing::IsSubstring,
+                            std::string("multiple_tensors.data, offset: 4294967296, data_length: 12, sha1_digest: 0)"),
+                            error.what());
+    } catch (...) {
+        FAIL() << "Importing onnx model failed for unexpected reason";
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_length_out_of_range_exception) {
+    // the length doesn't fit in 32 bits
+    try {
+        auto function = onnx_import::import_onnx_model(
+            file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data_length_out_of_range.onnx"));
+        FAIL() << "Length past the end of the external data file not detected";
+    } catch (const ngraph_error& error) {
+        EXPECT_PRED_FORMAT2(testing::IsSubstring,
+                            std::string("multiple_tensors.data, offset: 4096, "
+                                        "data_length: 8589934592, sha1_digest: 0)"),
+                            error.what());
+    } catch (...) {
+        FAIL() << "Importing onnx model failed for unexpected reason";
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception) {
     try {
         auto function = onnx_import::import_onnx_model(
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/xxhash.hpp"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace std;
+
+namespace {
+constexpr uint64_t seed = 2654435761ULL;
+
+// longer than a stripe of 32 bytes, so the four lanes are used
+const string long_input = "Nobody inspects the spammish repetition, 32+ bytes long input data";
+
+uint64_t hash_bytewise(const string& data, uint64_t hash_seed) {
+    ov::util::XXHash64 hash(hash_seed);
+    for (const auto& c : data) {
+        hash.update(&c, 1);
+    }
+    return hash.digest();
+}
+}  // namespace
+
+// The expected values are produced by the reference implementation of xxHash64
+
+TEST(xxhash, empty_input) {
+    EXPECT_EQ(ov::util::xxhash64(nullptr, 0), 0xEF46DB3751D8E999ULL);
+    EXPECT_EQ(ov::util::xxhash64(nullptr, 0, seed), 0xAC75FDA2929B17EFULL);
+    EXPECT_EQ(ov::util::XXHash64().digest(), 0xEF46DB3751D8E999ULL);
+    EXPECT_EQ(ov::util::XXHash64(seed).digest(), 0xAC75FDA2929B17EFULL);
+}
+
+TEST(xxhash, short_input) {
+    const string input = "abc";
+    EXPECT_EQ(ov::util::xxhash64(input.data(), input.size()), 0x44BC2CF5AD770999ULL);
+    EXPECT_EQ(ov::util::xxhash64(input.data(), input.size(), seed), 0x1318DF30094A85FDULL);
+    EXPECT_EQ(hash_bytewise(input, 0), 0x44BC2CF5AD770999ULL);
+    EXPECT_EQ(hash_bytewise(input, seed), 0x1318DF30094A85FDULL);
+}
+
+TEST(xxhash, long_input) {
+    ASSERT_GT(long_input.size(), 32);
+    EXPECT_EQ(ov::util::xxhash64(long_input.data(), long_input.size()), 0x0C2E0F5573014BEBULL);
+    EXPECT_EQ(ov::util::xxhash64(long_input.data(), long_input.size(), seed), 0x5F179E3B6A9872DFULL);
+    EXPECT_EQ(hash_bytewise(long_input, 0), 0x0C2E0F5573014BEBULL);
+    EXPECT_EQ(hash_bytewise(long_input, seed), 0x5F179E3B6A9872DFULL);
+}
+
+TEST(xxhash, digest_does_not_finish_hashing) {
+    ov::util::XXHash64 hash;
+    hash.update(long_input.data(), 10);
+    hash.digest();
+    hash.update(long_input.data() + 10, long_input.size() - 10);
+    EXPECT_EQ(hash.digest(), 0x0C2E0F5573014BEBULL);
+}
@@ -58,10 +58,12 @@ Graph::Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
       m_cache{std::move(cache)},
       m_telemetry(telemetry) {
     std::map<std::string, Tensor> initializers;
+    // The Constants refer to the data of the model and the external data files, so they aren't copied
+    const auto mapped_files = std::make_shared<detail::MappedFiles>();
     // Process all initializers in the graph
     for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
         if (initializer_tensor.has_name()) {
-            Tensor tensor = Tensor{initializer_tensor};
+            Tensor tensor = Tensor{initializer_tensor, model_proto, mapped_files};
             std::shared_ptr<default_opset::Constant> ng_constant;
             // For each initializer create a Constant node and store it in cache
             try {
@@ -7,10 +7,12 @@
 #include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_common/utils.hpp"
@@ -351,6 +353,19 @@ public:
         }
     }
 
+    /// \brief      Tensor whose Constant refers to the data of the model or the mapped external
+    ///             data file instead of copying it
+    ///
+    /// \param      model_proto   The model owning the tensor, kept alive by the Constant
+    /// \param      mapped_files  The external data files mapped for the model
+    Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+           const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
+           const std::shared_ptr<detail::MappedFiles>& mapped_files)
+        : Tensor(tensor) {
+        m_model_proto = model_proto;
+        m_mapped_files = mapped_files;
+    }
+
     Tensor(const Tensor&) = default;
     Tensor(Tensor&&) = default;
 
@@ -459,15 +474,54 @@ public:
 private:
     template <typename T>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
-        auto constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        auto constant = make_shared_ng_constant(type);
+        if (!constant) {
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        }
         if (m_tensor_proto->has_name()) {
             constant->set_friendly_name(get_name());
         }
         return constant;
     }
 
+    /// \brief      Creates the Constant referring to the external data or the raw data of the model.
+    ///             Returns nullptr if the data has to be copied: the tensor isn't owned by a model,
+    ///             the data is stored in the typed fields, its size doesn't match the shape or it
+    ///             isn't aligned to the element type.
+    std::shared_ptr<ngraph::op::Constant> make_shared_ng_constant(const element::Type& type) const {
+        const auto byte_size = shape_size(m_shape) * type.size();
+        auto is_shareable = [&](const char* data, size_t size) {
+            return byte_size != 0 && size == byte_size && reinterpret_cast<uintptr_t>(data) % type.size() == 0;
+        };
+
+        if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto)) {
+            if (!m_mapped_files) {
+                return nullptr;
+            }
+            const auto buffer = detail::TensorExternalData(*m_tensor_proto).load_external_mmap_data(*m_mapped_files);
+            if (!is_shareable(buffer->get_ptr<char>(), buffer->size())) {
+                return nullptr;
+            }
+            return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+        }
+        if (m_model_proto && m_tensor_proto->has_raw_data()) {
+            const auto& raw_data = m_tensor_proto->raw_data();
+            if (!is_shareable(raw_data.data(), raw_data.size())) {
+                return nullptr;
+            }
+            auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ONNX_NAMESPACE::ModelProto>>>(
+                const_cast<char*>(raw_data.data()),
+                raw_data.size(),
+                m_model_proto);
+            return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+        }
+        return nullptr;
+    }
+
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
+    std::shared_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
+    std::shared_ptr<detail::MappedFiles> m_mapped_files;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
@@ -218,6 +218,15 @@ struct onnx_editor::ONNXModelEditor::Impl {
         : m_model_proto{
               std::make_shared<ONNX_NAMESPACE::ModelProto>(ngraph::onnx_common::parse_from_file(model_path))} {}
 #endif
+
+    /// \brief Copies the model if it's referred by the Constants of the functions converted before,
+    ///        so the initializers can be removed or replaced without affecting them
+    void detach_from_functions() {
+        if (m_model_proto.use_count() > 1) {
+            m_model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>(*m_model_proto);
+            m_is_mapper_updated = false;
+        }
+    }
 };
 
 onnx_editor::ONNXModelEditor::ONNXModelEditor(const std::string& model_path,
@@ -342,6 +351,7 @@ void onnx_editor::ONNXModelEditor::cut_graph_fragment(const std::vector<InputEdg
         return;
     }
 
+    m_pimpl->detach_from_functions();
     InferShapesAutoRelease onnx_shapes(m_pimpl->m_model_proto);
     onnx_shapes.infer_shapes();
 
@@ -420,6 +430,7 @@ std::shared_ptr<Function> onnx_editor::ONNXModelEditor::get_function() const {
 
 void onnx_editor::ONNXModelEditor::set_input_values(
     const std::map<std::string, std::shared_ptr<ngraph::op::Constant>>& input_values) {
+    m_pimpl->detach_from_functions();
     auto onnx_graph = m_pimpl->m_model_proto->mutable_graph();
 
     for (const auto& input : input_values) {
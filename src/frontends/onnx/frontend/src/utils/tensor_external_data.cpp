@@ -20,9 +20,9 @@ TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor
         if (entry.key() == "location")
             m_data_location = entry.value();
         if (entry.key() == "offset")
-            m_offset = std::stoi(entry.value());
+            m_offset = std::stoull(entry.value());
         if (entry.key() == "length")
-            m_data_length = std::stoi(entry.value());
+            m_data_length = std::stoull(entry.value());
         if (entry.key() == "checksum")
             m_sha1_digest = std::stoi(entry.value());
     }
@@ -40,18 +40,12 @@ std::string TensorExternalData::load_external_data() const {
     if (external_data_stream.fail())
         throw error::invalid_external_data{*this};
 
-    std::streamsize read_data_length;
-    if (m_data_length == 0)  // read entire file
-        read_data_length = external_data_stream.tellg();
-    else
-        read_data_length = m_data_length;
+    const uint64_t file_size = external_data_stream.tellg();
+    if (m_offset > file_size || m_data_length > file_size - m_offset)
+        throw error::invalid_external_data{*this};
+    // the data is read until the end of file if the length isn't specified
+    const auto read_data_length = static_cast<std::streamsize>(m_data_length == 0 ? file_size - m_offset : m_data_length);
 
-    const auto page_size = 4096;
-    if (m_offset != 0 && m_offset % page_size != 0) {
-        NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                       "support, current value is "
-                    << m_offset;
-    }
     // default value of m_offset is 0
     external_data_stream.seekg(m_offset, std::ios::beg);
 
@@ -67,6 +61,36 @@ std::string TensorExternalData::load_external_data() const {
     return read_data;
 }
 
+std::shared_ptr<MappedBuffer> TensorExternalData::load_external_mmap_data(MappedFiles& mapped_files) const {
+    auto& mapped_file = mapped_files[m_data_location];
+    if (!mapped_file) {
+        try {
+            NGRAPH_SUPPRESS_DEPRECATED_START
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+            mapped_file = ov::util::load_mmap_object(ov::util::string_to_wstring(m_data_location));
+#else
+            mapped_file = ov::util::load_mmap_object(m_data_location);
+#endif
+            NGRAPH_SUPPRESS_DEPRECATED_END
+        } catch (const std::exception&) {
+            mapped_files.erase(m_data_location);
+            throw error::invalid_external_data{*this};
+        }
+    }
+
+    const uint64_t file_size = mapped_file->size();
+    if (m_offset > file_size || m_data_length > file_size - m_offset)
+        throw error::invalid_external_data{*this};
+    // the data is read until the end of file if the length isn't specified
+    const auto data_length = m_data_length == 0 ? file_size - m_offset : m_data_length;
+
+    if (m_sha1_digest != 0) {
+        NGRAPH_WARN << "SHA1 checksum is not supported";
+    }
+
+    return std::make_shared<MappedBuffer>(mapped_file->data() + m_offset, static_cast<size_t>(data_length), mapped_file);
+}
+
 std::string TensorExternalData::to_string() const {
     std::stringstream s;
     s << "ExternalDataInfo(";
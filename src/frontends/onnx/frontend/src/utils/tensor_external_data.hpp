@@ -6,9 +6,23 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+/// \brief  The external data files mapped to the memory by their paths, so the file storing
+///         several tensors is mapped once
+using MappedFiles = std::map<std::string, std::shared_ptr<ov::util::MappedMemory>>;
+
+/// \brief  Buffer referring to the part of the mapped external data file
+using MappedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -23,6 +37,17 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data() const;
 
+    /// \brief      Map external data from tensor passed to constructor to the memory
+    ///
+    /// \note       The pages of the file are loaded on demand and shared with the other
+    ///             processes, the data isn't copied. If mapping the file fails or the data
+    ///             exceeds the file, the invalid_external_data exception is thrown.
+    ///
+    /// \param      mapped_files  The files mapped before, the file is added if it's not there
+    ///
+    /// \return     Buffer referring to the tensor data, which keeps the file mapped
+    std::shared_ptr<MappedBuffer> load_external_mmap_data(MappedFiles& mapped_files) const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
@@ -30,8 +55,8 @@ public:
 
 private:
     std::string m_data_location{};
-    int m_offset = 0;
-    int m_data_length = 0;
+    uint64_t m_offset = 0;
+    uint64_t m_data_length = 0;
     int m_sha1_digest = 0;
 };
 }  // namespace detail
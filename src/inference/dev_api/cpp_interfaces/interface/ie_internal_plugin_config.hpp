@@ -52,6 +52,15 @@ DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
  */
 DECLARE_CONFIG_KEY(FORCE_DISABLE_CACHE);
 
+/**
+ * @brief Defines whether the weights of a network read from files are identified by the path, modification time and
+ *        size of the files instead of hashing their content when the cache entry is looked up (YES/NO, NO by default)
+ *        Set to Core along with CACHE_DIR before the network is read, the info of the files is recorded by
+ *        Core::ReadNetwork only when both keys are set
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CACHE_SKIP_WEIGHTS_HASHING);
+
 /**
  * @brief The name for setting work mode internal in MULTI device plugin option.
  */
@@ -62,6 +71,61 @@ DECLARE_CONFIG_KEY(MULTI_WORK_MODE_AS_AUTO);
  */
 DECLARE_CONFIG_KEY(CONFIG_DEVICE_ID);
 
+/**
+ * @brief Defines Snippets tokenization mode
+ *      @param ENABLE - default pipeline
+ *      @param IGNORE_CALLBACK - disable the Snippets markup transformation and tokenization callback
+ *      @param DISABLE - turn off the Snippets
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(SNIPPETS_MODE);
+DECLARE_CONFIG_VALUE(ENABLE);
+DECLARE_CONFIG_VALUE(IGNORE_CALLBACK);
+DECLARE_CONFIG_VALUE(DISABLE);
+
+/**
+ * @brief Defines the number of primitives for different input shapes each node keeps cached in case of dynamic shapes
+ *      Zero value turns the cache off
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
+
+/**
+ * @brief Defines whether an infer request keeps running on the same stream of the CPU streams executor
+ *      The request still may be executed by another stream if its own one is busy
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAM_AFFINITY);
+
+/**
+ * @brief Defines whether independent branches of a graph are executed concurrently by the threads of one stream
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
+
+/**
+ * @brief Defines the directory where the CPU plugin keeps the results of the graph constant path (e.g. reordered weights)
+ *      to reuse them in other processes and on restart. Empty value turns the cache off
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_CACHE_DIR);
+
+/**
+ * @brief Defines whether the CPU plugin collects the hardware performance counters (cycles, instructions, LLC misses)
+ *      of each node along with its execution time. Takes effect if PERF_COUNT is enabled, available on Linux only.
+ *      The counters are per thread and summed over the threads of the plugin, so the values of a node include the work
+ *      done by the same threads for the other streams and the concurrently executed nodes
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_HW_PERF_COUNTERS);
+
+/**
+ * @brief Defines whether the CPU plugin reselects the layouts of the nodes over the whole graph to reduce the number
+ *      of reorders. Disabled by default
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_LAYOUT_OPTIMIZATION);
+
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
@@ -20,7 +20,7 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from per-stream queues, idle threads steal tasks from the other queues.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -42,6 +42,14 @@ public:
 
     void run(Task task) override;
 
+    /**
+     * @brief Runs the task preferably on the given stream, so the tasks with the same stream index reuse the data
+     *        already loaded into the caches of its cores. The task still can be executed by another stream if it is idle.
+     * @param task A task to start
+     * @param streamIndex Index of the preferred stream, wrapped around the number of streams
+     */
+    void run(Task task, int streamIndex);
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
@@ -18,6 +18,7 @@
 #include "ie_itt.hpp"
 #include "ngraph/opsets/opset6.hpp"
 #include "ngraph/variant.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/manager.hpp"
 #include "transformations/hash.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
@@ -42,8 +43,9 @@ static int32_t as_int32_t(T v) {
 
 //////////////////////////////////////////////////
 
-std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
-    uint64_t seed = 0;
+constexpr const char* NetworkCompilationContext::modelFileInfoKey;
+
+static uint64_t hashFileInfo(uint64_t seed, const std::string& filePath) {
     auto absPath = filePath;
     try {
         absPath = FileUtils::absoluteFilePath(filePath);
@@ -53,27 +55,83 @@ std::string NetworkCompilationContext::calculateFileInfo(const std::string& file
 
     seed = hash_combine(seed, absPath);
 
-    std::string res;
     struct stat result;
     if (stat(absPath.c_str(), &result) == 0) {
         seed = hash_combine(seed, result.st_mtime);
         seed = hash_combine(seed, result.st_size);
     }
+    return seed;
+}
+
+std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
+    uint64_t seed = hashFileInfo(0, filePath);
+
+    // IR keeps the weights in a separate file, so the changes of weights are taken into account as well
+    const auto ext = FileUtils::fileExt(filePath);
+    if (ext == "xml") {
+        const auto weightsPath = filePath.substr(0, filePath.size() - ext.size()) + "bin";
+        if (FileUtils::fileExist(weightsPath)) {
+            seed = hashFileInfo(seed, weightsPath);
+        }
+    }
     return std::to_string(seed);
 }
 
+std::string NetworkCompilationContext::calculateFileInfo(const std::string& modelPath, const std::string& weightsPath) {
+    if (weightsPath.empty()) {
+        return calculateFileInfo(modelPath);
+    }
+    return std::to_string(hashFileInfo(hashFileInfo(0, modelPath), weightsPath));
+}
+
+static void markConstantsFromFile(const ngraph::Function& function) {
+    for (const auto& op : function.get_ordered_ops()) {
+        if (ngraph::is_type<ngraph::opset6::Constant>(op)) {
+            op->get_rt_info()[ov::pass::Hash::weights_file_key] = std::make_shared<ngraph::VariantWrapper<std::string>>("");
+        } else if (const auto multiSubGraph = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(op)) {
+            for (size_t i = 0; i < multiSubGraph->get_internal_subgraphs_size(); i++) {
+                markConstantsFromFile(*multiSubGraph->get_function(static_cast<int>(i)));
+            }
+        }
+    }
+}
+
+void NetworkCompilationContext::setFileInfo(const CNNNetwork& network, const std::string& fileInfo) {
+    const auto function = network.getFunction();
+    if (!function)
+        return;
+    function->get_rt_info()[modelFileInfoKey] = std::make_shared<ngraph::VariantWrapper<std::string>>(fileInfo);
+    markConstantsFromFile(*function);
+}
+
 std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
-                                                   const std::map<std::string, std::string>& compileOptions) {
+                                                   const std::map<std::string, std::string>& compileOptions,
+                                                   bool skipWeightsHashing) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_LT, "NetworkCompilationContext::computeHash - CNN");
 
     IE_ASSERT(network.getFunction());
 
+    // Weights are identified by the info of the files the network was read from, if it's known
+    std::string fileInfo;
+    if (skipWeightsHashing) {
+        const auto& rtInfo = network.getFunction()->get_rt_info();
+        auto it = rtInfo.find(modelFileInfoKey);
+        if (it != rtInfo.end()) {
+            if (auto fileInfoData = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(it->second)) {
+                fileInfo = fileInfoData->get();
+            }
+        }
+    }
+
     uint64_t seed = 0;
     // 1. Calculate hash on function
     CNNNetwork net(network);
     ov::pass::Manager m;
-    m.register_pass<ov::pass::Hash>(seed);
+    m.register_pass<ov::pass::Hash>(seed, fileInfo.empty());
     m.run_passes(net.getFunction());
+    if (!fileInfo.empty()) {
+        seed = hash_combine(seed, fileInfo);
+    }
 
     // 2. Compute hash on serialized data and options
     for (const auto& kvp : compileOptions) {
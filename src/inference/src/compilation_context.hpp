@@ -14,9 +14,34 @@ namespace InferenceEngine {
 class CNNNetwork;
 
 struct NetworkCompilationContext final {
+    /**
+     * @brief Key of the function runtime info which keeps the info of the files the network was read from
+     */
+    static constexpr const char* modelFileInfoKey = "model_file_info";
+
+    /**
+     * @brief Calculates hash of the path, modification time and size of the file.
+     * For IR model (*.xml) the weights file with the same name is taken into account as well
+     */
     static std::string calculateFileInfo(const std::string& filePath);
 
-    static std::string computeHash(const CNNNetwork& network, const std::map<std::string, std::string>& compileOptions);
+    static std::string calculateFileInfo(const std::string& modelPath, const std::string& weightsPath);
+
+    /**
+     * @brief Keeps the info of the files in the network and marks its constants as read from the weights file.
+     * Only the data of the marked constants is skipped by computeHash with skipWeightsHashing, so the constants added
+     * to the network after it is read are still hashed
+     */
+    static void setFileInfo(const CNNNetwork& network, const std::string& fileInfo);
+
+    /**
+     * @brief Computes hash of the network and the compile options
+     * @param skipWeightsHashing If true and the network was read from files, the info of the files is hashed instead
+     * of the data of the constants
+     */
+    static std::string computeHash(const CNNNetwork& network,
+                                   const std::map<std::string, std::string>& compileOptions,
+                                   bool skipWeightsHashing = false);
 
     static std::string computeHash(const std::string& modelName,
                                    const std::map<std::string, std::string>& compileOptions);
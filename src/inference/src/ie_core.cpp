@@ -120,9 +120,24 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         struct CacheConfig {
             std::string _cacheDir;
             std::shared_ptr<ie::ICacheManager> _cacheManager;
+            bool _skipWeightsHashing = false;
         };
 
         void setAndUpdate(std::map<std::string, std::string>& config) {
+            auto skipIt = config.find(CONFIG_KEY_INTERNAL(CACHE_SKIP_WEIGHTS_HASHING));
+            if (skipIt != config.end()) {
+                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+                if (skipIt->second == CONFIG_VALUE(YES)) {
+                    _cacheConfig._skipWeightsHashing = true;
+                } else if (skipIt->second == CONFIG_VALUE(NO)) {
+                    _cacheConfig._skipWeightsHashing = false;
+                } else {
+                    IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CACHE_SKIP_WEIGHTS_HASHING)
+                               << ". Expected only YES/NO";
+                }
+                config.erase(skipIt);
+            }
+
             auto it = config.find(CONFIG_KEY(CACHE_DIR));
             if (it != config.end()) {
                 std::lock_guard<std::mutex> lock(_cacheConfigMutex);
@@ -344,7 +359,9 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                                      const ov::runtime::InferencePlugin& plugin,
                                      const std::map<std::string, std::string>& config) const {
         auto compileConfig = CreateCompileConfig(plugin, deviceFamily, config);
-        return ie::NetworkCompilationContext::computeHash(network, compileConfig);
+        return ie::NetworkCompilationContext::computeHash(network,
+                                                          compileConfig,
+                                                          coreConfig.getCacheConfig()._skipWeightsHashing);
     }
 
     std::string CalculateFileHash(const std::string& modelName,
@@ -464,7 +481,16 @@ public:
 
     ie::CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from file");
-        return InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, ov_extensions, newAPI);
+        auto network = InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, ov_extensions, newAPI);
+        // allows to identify the weights by the files instead of hashing them when the network is compiled with
+        // the cache, the info is used by the cache lookup only
+        const auto cacheConfig = coreConfig.getCacheConfig();
+        if (cacheConfig._cacheManager && cacheConfig._skipWeightsHashing) {
+            ie::NetworkCompilationContext::setFileInfo(
+                network,
+                ie::NetworkCompilationContext::calculateFileInfo(modelPath, binPath));
+        }
+        return network;
     }
 
     ie::CNNNetwork ReadNetwork(const std::string& model, const ie::Blob::CPtr& weights) const override {
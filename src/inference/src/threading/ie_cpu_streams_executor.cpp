@@ -8,6 +8,7 @@
 #include <cassert>
 #include <climits>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -215,35 +216,80 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _workerQueues.emplace_back(new WorkerQueue);
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                for (;;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
+                    if (Pop(streamId, task)) {
                         Execute(task, *(_streams.local()));
+                        continue;
+                    }
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    ++_sleepingWorkers;
+                    _queueCondVar.wait(lock, [&] {
+                        return _pendingTasks > 0 || _isStopped;
+                    });
+                    --_sleepingWorkers;
+                    if (_isStopped && _pendingTasks == 0) {
+                        break;
                     }
                 }
             });
         }
     }
 
-    void Enqueue(Task task) {
+    // Each worker thread has its own queue, so the producers and the workers do not contend on the single lock.
+    // A worker takes the tasks from its own queue first and steals them from the other queues when it is idle.
+    struct WorkerQueue {
+        std::mutex _mutex;
+        std::deque<Task> _tasks;
+    };
+
+    bool Pop(const int workerId, Task& task) {
+        const auto numQueues = _workerQueues.size();
+        for (std::size_t i = 0; i < numQueues; ++i) {
+            auto& queue = *_workerQueues[(workerId + i) % numQueues];
+            // the own queue is always locked, while the busy queues of the other workers are just skipped
+            std::unique_lock<std::mutex> lock(queue._mutex, std::defer_lock);
+            if (i == 0) {
+                lock.lock();
+            } else if (!lock.try_lock()) {
+                continue;
+            }
+            if (!queue._tasks.empty()) {
+                task = std::move(queue._tasks.front());
+                queue._tasks.pop_front();
+                --_pendingTasks;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Enqueue(Task task, const int preferredWorkerId = -1) {
+        const auto numQueues = _workerQueues.size();
+        const auto workerId = (preferredWorkerId < 0) ? _nextWorkerId++ % numQueues
+                                                       : static_cast<std::size_t>(preferredWorkerId) % numQueues;
         {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            auto& queue = *_workerQueues[workerId];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            // the counter is updated under the same lock as in Pop(), so a worker can not decrement it before
+            // the increment of the task it has taken
+            ++_pendingTasks;
+            queue._tasks.emplace_back(std::move(task));
+        }
+        // the workers register themselves as sleeping before checking the pending tasks counter under the mutex,
+        // so the notification can not be lost, while the busy workers are not disturbed at all
+        if (_sleepingWorkers > 0) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+            }
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -280,10 +326,13 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
+    std::vector<std::unique_ptr<WorkerQueue>> _workerQueues;
+    std::atomic<std::size_t> _pendingTasks{0};
+    std::atomic<std::size_t> _nextWorkerId{0};
+    std::atomic<int> _sleepingWorkers{0};
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
-    bool _isStopped = false;
+    std::atomic<bool> _isStopped{false};
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -333,4 +382,12 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::run(Task task, int streamIndex) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), streamIndex);
+    }
+}
+
 }  // namespace InferenceEngine